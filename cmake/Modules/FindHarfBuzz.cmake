@@ -0,0 +1,20 @@
+#
+# Try to find HarfBuzz library and include paths.
+# Once done this will define
+#
+# HARFBUZZ_FOUND
+# HARFBUZZ_INCLUDE_DIRS
+# HARFBUZZ_LIBRARIES
+#
+
+find_path(HARFBUZZ_INCLUDE_DIR hb.h PATH_SUFFIXES harfbuzz)
+
+find_library(HARFBUZZ_LIBRARY NAMES harfbuzz)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(HARFBUZZ DEFAULT_MSG HARFBUZZ_LIBRARY HARFBUZZ_INCLUDE_DIR)
+
+set(HARFBUZZ_INCLUDE_DIRS ${HARFBUZZ_INCLUDE_DIR})
+set(HARFBUZZ_LIBRARIES ${HARFBUZZ_LIBRARY})
+
+mark_as_advanced(HARFBUZZ_INCLUDE_DIR HARFBUZZ_LIBRARY)
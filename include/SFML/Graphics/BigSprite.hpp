@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_BIGSPRITE_HPP
+#define SFML_BIGSPRITE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+
+namespace sf
+{
+class TiledTexture;
+
+////////////////////////////////////////////////////////////
+/// \brief Drawable representation of a tiled texture, with
+///        its own transformations, color, etc.
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API BigSprite : public Drawable, public Transformable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty sprite with no source texture.
+    ///
+    ////////////////////////////////////////////////////////////
+    BigSprite();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the sprite from a tiled texture
+    ///
+    /// \param texture Source tiled texture
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit BigSprite(const TiledTexture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the source tiled texture of the sprite
+    ///
+    /// The \a texture argument refers to a tiled texture that
+    /// must exist as long as the sprite uses it.
+    ///
+    /// \param texture New tiled texture
+    ///
+    /// \see getTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const TiledTexture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the global color of the sprite
+    ///
+    /// This color is modulated (multiplied) with the sprite's
+    /// texture. It can be used to colorize the sprite, or change
+    /// its global opacity.
+    /// By default, the sprite's color is opaque white.
+    ///
+    /// \param color New color of the sprite
+    ///
+    /// \see getColor
+    ///
+    ////////////////////////////////////////////////////////////
+    void setColor(const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the source tiled texture of the sprite
+    ///
+    /// If the sprite has no source texture, a NULL pointer is returned.
+    ///
+    /// \return Pointer to the sprite's tiled texture
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    const TiledTexture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global color of the sprite
+    ///
+    /// \return Global color of the sprite
+    ///
+    /// \see setColor
+    ///
+    ////////////////////////////////////////////////////////////
+    const Color& getColor() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the entity.
+    ///
+    /// \return Local bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the entity.
+    ///
+    /// \return Global bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getGlobalBounds() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the visible tiles of the sprite to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const TiledTexture* m_texture; ///< Tiled texture of the sprite
+    Color               m_color;   ///< Global color of the sprite
+};
+
+} // namespace sf
+
+
+#endif // SFML_BIGSPRITE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::BigSprite
+/// \ingroup graphics
+///
+/// sf::BigSprite is the equivalent of sf::Sprite for
+/// sf::TiledTexture: it displays the whole tiled texture, with
+/// its own transformation and color.
+///
+/// When it is drawn, only the tiles which intersect the current
+/// view of the render target are drawn, and their textures are
+/// uploaded at this moment if they were not yet. Scrolling
+/// through a huge image thus only costs the memory and the
+/// uploads of the area which is actually seen.
+///
+/// Like sf::Sprite, sf::BigSprite doesn't copy the tiled texture
+/// that it uses, which must exist as long as it is used.
+///
+/// Usage example:
+/// \code
+/// sf::TiledTexture map;
+/// map.loadFromFile("world.png");
+///
+/// sf::BigSprite sprite(map);
+/// sprite.setScale(0.5f, 0.5f);
+///
+/// window.setView(camera);
+/// window.draw(sprite);
+/// \endcode
+///
+/// \see sf::TiledTexture, sf::Sprite
+///
+////////////////////////////////////////////////////////////
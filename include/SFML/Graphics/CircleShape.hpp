@@ -30,6 +30,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Export.hpp>
 #include <SFML/Graphics/Shape.hpp>
+#include <vector>
 
 
 namespace sf
@@ -108,11 +109,18 @@ public:
 
 private:
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the geometry from the shared unit circle
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateGeometry();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    float       m_radius;     ///< Radius of the circle
-    std::size_t m_pointCount; ///< Number of points composing the circle
+    float                        m_radius;     ///< Radius of the circle
+    std::size_t                  m_pointCount; ///< Number of points composing the circle
+    const std::vector<Vector2f>* m_unitCircle; ///< Shared unit circle with the same number of points
 };
 
 } // namespace sf
@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_COMMANDBUFFER_HPP
+#define SFML_COMMANDBUFFER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Render target that records draws, to replay them
+///        later on another target
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API CommandBuffer : public RenderTarget
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty command buffer, with a size of 0x0.
+    ///
+    ////////////////////////////////////////////////////////////
+    CommandBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty command buffer with a size
+    ///
+    /// \param size Size of the command buffer, see setSize
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit CommandBuffer(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the size of the command buffer
+    ///
+    /// The command buffer doesn't own any pixel, but its size
+    /// defines the default view, which drawables may use (to skip
+    /// what is not visible, for example). It should match
+    /// the size of the target the commands are replayed on.
+    ///
+    /// This function resets the current view to the new default view.
+    ///
+    /// \param size New size of the command buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSize(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the command buffer
+    ///
+    /// \return Size of the command buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Vector2u getSize() const;
+
+    using RenderTarget::draw;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record primitives defined by an array of vertices
+    ///
+    /// The vertices are copied and transformed right away, in
+    /// the calling thread. A draw which uses the same shader,
+    /// texture and blend mode as the previous one is merged with it.
+    /// The texture and shader are only referenced: they must
+    /// still exist, with the same contents, when the command
+    /// buffer is replayed.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(const Vertex* vertices, std::size_t vertexCount,
+                      PrimitiveType type, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the recorded commands to a target
+    ///
+    /// The commands are drawn in the order they were recorded.
+    /// They are kept, so that the same commands can be replayed
+    /// several times; call reset to remove them.
+    ///
+    /// This function must be called from the thread which renders
+    /// to \a target.
+    ///
+    /// \param target Target to draw to
+    ///
+    ////////////////////////////////////////////////////////////
+    void replay(RenderTarget& target) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the recorded commands
+    ///
+    /// The memory is kept, so that the next frame doesn't
+    /// need to allocate it again.
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of recorded commands
+    ///
+    /// This is the number of draw calls that replay will
+    /// issue, after merging.
+    ///
+    /// \return Number of commands
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCommandCount() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate the target for rendering
+    ///
+    /// The command buffer has no OpenGL context: this function
+    /// always fails, so that the functions of sf::RenderTarget
+    /// which use OpenGL directly (clear, pushGLStates, ...) do nothing.
+    ///
+    /// \param active True to activate, false to deactivate
+    ///
+    /// \return Always false
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool activate(bool active);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recorded draw
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Command
+    {
+        RenderStates  states; ///< States of the draw, with an identity transform
+        PrimitiveType type;   ///< Type of primitives (never a strip or a fan)
+        std::size_t   first;  ///< Index of the first vertex in the vertex storage
+        std::size_t   count;  ///< Number of vertices
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u             m_size;     ///< Size of the command buffer
+    std::vector<Command> m_commands; ///< Recorded draws, in order
+    std::vector<Vertex>  m_vertices; ///< Transformed vertices of the recorded draws
+};
+
+} // namespace sf
+
+
+#endif // SFML_COMMANDBUFFER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::CommandBuffer
+/// \ingroup graphics
+///
+/// Drawing an entity is not only about OpenGL: the entity
+/// must compute its transform, maybe rebuild its geometry (text,
+/// shapes), and its vertices must be transformed. All this work
+/// normally runs in the thread which owns the render target.
+///
+/// sf::CommandBuffer is a render target which doesn't use
+/// OpenGL itself: it only records the draws, with their vertices
+/// already transformed. Several command buffers can therefore be
+/// filled in parallel, in different threads, and then replayed
+/// in order on the real target by the rendering thread; the
+/// replay is cheap, since consecutive draws which share the
+/// same states are merged.
+///
+/// A command buffer must only be filled by one thread at a
+/// time, and the entities must not be modified while they are
+/// recorded. The entities themselves may still use OpenGL when
+/// they are drawn: this is the case of sf::Text, which writes
+/// the glyphs that it loads on demand to the texture of its
+/// font. To record texts in worker threads, their font must be
+/// in thread-safe mode (see sf::Font::setThreadSafe) and the
+/// glyphs must be loaded beforehand by the rendering thread,
+/// for example by drawing the texts once, or by requesting the
+/// glyphs with sf::Font::getGlyph and then calling
+/// sf::Font::getTexture. Otherwise, the missing glyphs are
+/// written to the texture from the worker thread, while the
+/// rendering thread may be using it.
+///
+/// Usage example:
+/// \code
+/// // One command buffer per worker thread
+/// sf::CommandBuffer buffers[threadCount];
+///
+/// // In the worker threads
+/// buffers[i].reset();
+/// buffers[i].setSize(window.getSize());
+/// buffers[i].setView(window.getView());
+/// for (std::size_t j = begin[i]; j < end[i]; ++j)
+///     buffers[i].draw(entities[j]);
+///
+/// // In the rendering thread, once the workers are done
+/// window.clear();
+/// for (std::size_t i = 0; i < threadCount; ++i)
+///     buffers[i].replay(window);
+/// window.display();
+/// \endcode
+///
+/// The view of the command buffer is only seen by the drawables
+/// that query it while they are recorded; the commands are
+/// replayed with the current view of the destination target.
+///
+/// \see sf::RenderTarget, sf::RenderQueue
+///
+////////////////////////////////////////////////////////////
@@ -34,6 +34,7 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/String.hpp>
+#include <SFML/System/Mutex.hpp>
 #include <map>
 #include <string>
 #include <vector>
@@ -156,6 +157,9 @@ public:
     /// might be available. If the glyph is not available at the
     /// requested size, an empty glyph is returned.
     ///
+    /// If subpixel positioning is enabled, the returned glyph is
+    /// the variant rendered for a pen located exactly on a pixel.
+    ///
     /// \param codePoint     Unicode code point of the character to get
     /// \param characterSize Reference character size
     /// \param bold          Retrieve the bold version or the regular one?
@@ -232,6 +236,10 @@ public:
     /// are requested, thus it is not very relevant. It is mainly
     /// used internally by sf::Text.
     ///
+    /// The pixels of newly loaded glyphs are written to the texture
+    /// by this function, so when the font is thread-safe it must
+    /// be called from the thread which renders the text.
+    ///
     /// \param characterSize Reference character size
     ///
     /// \return Texture containing the glyphs of the requested size
@@ -239,6 +247,120 @@ public:
     ////////////////////////////////////////////////////////////
     const Texture& getTexture(unsigned int characterSize) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a fallback font
+    ///
+    /// When a character is not available in this font, it is
+    /// looked up in the fallback fonts, in the order in which
+    /// they were added. Glyphs found in a fallback font are
+    /// rendered into the texture of this font, so that a text
+    /// mixing several fonts is still drawn in a single batch.
+    /// The global metrics (line spacing, underline) are always
+    /// the ones of this font.
+    ///
+    /// The \a font argument refers to a font that must exist
+    /// as long as this font uses it. At most 15 fallback fonts
+    /// can be added.
+    ///
+    /// Characters which were already requested are not looked
+    /// up again, so fallbacks should be added before the font
+    /// is used. Fallbacks can't be changed while the font is in
+    /// thread-safe mode, since other threads may still use the
+    /// glyphs that must be discarded.
+    ///
+    /// \param font Fallback font to add
+    ///
+    /// \return True if the fallback was added, false if too many fallbacks were added or the font is in thread-safe mode
+    ///
+    /// \see clearFallbacks
+    ///
+    ////////////////////////////////////////////////////////////
+    bool addFallback(const Font& font);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the fallback fonts
+    ///
+    /// This function does nothing if the font is in
+    /// thread-safe mode.
+    ///
+    /// \see addFallback
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearFallbacks();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable subpixel positioning
+    ///
+    /// By default, glyphs are hinted and placed at integer pen
+    /// positions, which gives sharp text but makes small moving
+    /// or scaled text jitter. When subpixel positioning is enabled,
+    /// glyphs use light (vertical only) hinting and fractional
+    /// advances, and each glyph is rendered in 4 horizontal
+    /// variants (shifted by a quarter of pixel); sf::Text then
+    /// picks the variant closest to the exact pen position.
+    /// This is only supported by scalable fonts.
+    ///
+    /// Glyphs rendered in both modes are cached separately, so
+    /// the mode can be changed at any time; texts using the font
+    /// must be updated (for example by setting their string
+    /// again) to use the new mode.
+    /// Subpixel positioning is disabled by default.
+    ///
+    /// \param enabled True to enable subpixel positioning, false to disable it
+    ///
+    /// \see isSubpixelPositioningEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSubpixelPositioningEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether subpixel positioning is enabled or not
+    ///
+    /// \return True if subpixel positioning is enabled, false if it is disabled
+    ///
+    /// \see setSubpixelPositioningEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isSubpixelPositioningEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the thread-safe mode
+    ///
+    /// By default, a font must only be used from one thread at
+    /// a time. In thread-safe mode, the accesses to the glyph
+    /// cache and to the font face are serialized, so that texts
+    /// using the same font can be laid out concurrently (for
+    /// example sf::Text::getLocalBounds or findCharacterPos
+    /// called from worker threads) while another thread draws.
+    ///
+    /// Glyphs which are not cached yet are rasterized by the
+    /// thread which requests them, but their pixels are only
+    /// written to the texture by getTexture, which is called
+    /// by sf::Text when it is drawn; this way, no OpenGL call
+    /// is made by the worker threads.
+    ///
+    /// Fallback fonts must be added before the thread-safe
+    /// mode is enabled.
+    ///
+    /// The thread-safe mode is disabled by default.
+    ///
+    /// \param threadSafe True to enable the thread-safe mode, false to disable it
+    ///
+    /// \see isThreadSafe
+    ///
+    ////////////////////////////////////////////////////////////
+    void setThreadSafe(bool threadSafe);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the font is in thread-safe mode or not
+    ///
+    /// \return True if the thread-safe mode is enabled, false if it is disabled
+    ///
+    /// \see setThreadSafe
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isThreadSafe() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
@@ -251,6 +373,8 @@ public:
 
 private:
 
+    friend class Text;
+
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a row of glyphs
     ///
@@ -267,7 +391,44 @@ private:
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    typedef std::map<Uint32, Glyph> GlyphTable; ///< Table mapping a codepoint to its glyph
+    typedef std::map<Uint32, Glyph> GlyphTable; ///< Table mapping a codepoint or a glyph index to its glyph
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Glyph produced by the text shaper
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ShapedGlyph
+    {
+        Uint32      index;     ///< Index of the glyph in its font face
+        std::size_t face;      ///< Face containing the glyph (0 for this font, n for the n-th fallback)
+        std::size_t character; ///< Index of the first character of the glyph's cluster
+        Vector2f    offset;    ///< Offset of the glyph from the left edge of its cluster
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Result of the shaping of a string
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ShapedRun
+    {
+        std::vector<Uint32>      codePoints;  ///< Shaped string, used to resolve hash collisions
+        bool                     bold;        ///< Was the string shaped with the bold style?
+        bool                     rightToLeft; ///< Is the string written from right to left?
+        std::vector<ShapedGlyph> glyphs;      ///< Shaped glyphs, sorted by cluster in logical order
+        std::vector<float>       advances;    ///< Advance of each character (0 for all but the first character of a cluster)
+    };
+
+    typedef std::map<Uint32, ShapedRun> ShapedRunTable; ///< Table mapping the hash of a string to its shaped run
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pixels of a glyph waiting to be written to the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PendingGlyph
+    {
+        IntRect            rect;   ///< Area of the texture to update
+        std::vector<Uint8> pixels; ///< RGBA pixels of the glyph
+    };
 
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a page of glyphs
@@ -277,10 +438,13 @@ private:
     {
         Page();
 
-        GlyphTable       glyphs;  ///< Table mapping code points to their corresponding glyph
-        sf::Texture      texture; ///< Texture containing the pixels of the glyphs
-        unsigned int     nextRow; ///< Y position of the next new row in the texture
-        std::vector<Row> rows;    ///< List containing the position of all the existing rows
+        GlyphTable                glyphs;  ///< Table mapping code points and glyph indices to their corresponding glyph
+        sf::Texture               texture; ///< Texture containing the pixels of the glyphs
+        Vector2u                  size;    ///< Size of the texture once the pending glyphs are written
+        unsigned int              nextRow; ///< Y position of the next new row in the texture
+        std::vector<Row>          rows;    ///< List containing the position of all the existing rows
+        ShapedRunTable            runs;    ///< Cache of the strings recently shaped at this size
+        std::vector<PendingGlyph> pending; ///< Glyphs rasterized but not written to the texture yet
     };
 
     ////////////////////////////////////////////////////////////
@@ -290,16 +454,110 @@ private:
     void cleanup();
 
     ////////////////////////////////////////////////////////////
-    /// \brief Load a new glyph and store it in the cache
+    /// \brief Remove the cached glyphs affected by a change of the fallbacks
+    ///
+    /// Glyphs cached by code point and shaped strings are always
+    /// removed, since they may now resolve to another face.
+    ///
+    /// \param fallbackGlyphs Also remove the glyphs rendered from the fallbacks?
+    ///
+    ////////////////////////////////////////////////////////////
+    void forgetResolvedGlyphs(bool fallbackGlyphs);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the face containing a character
+    ///
+    /// \param codePoint  Unicode code point of the character to find
+    /// \param glyphIndex Receives the index of the glyph in the face (0 if not found)
     ///
-    /// \param codePoint     Unicode code point of the character to load
+    /// \return Face containing the glyph (0 for this font, n for the n-th fallback)
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t findFace(Uint32 codePoint, Uint32& glyphIndex) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve a subpixel variant of a glyph of the font
+    ///
+    /// \param codePoint     Unicode code point of the character to get
     /// \param characterSize Reference character size
     /// \param bold          Retrieve the bold version or the regular one?
+    /// \param phase         Horizontal offset of the pen, in quarters of pixel (ignored without subpixel positioning)
     ///
     /// \return The glyph corresponding to \a codePoint and \a characterSize
     ///
     ////////////////////////////////////////////////////////////
-    Glyph loadGlyph(Uint32 codePoint, unsigned int characterSize, bool bold) const;
+    const Glyph& getGlyph(Uint32 codePoint, unsigned int characterSize, bool bold, unsigned int phase) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve a glyph of the font from its index in the face
+    ///
+    /// This function is used by sf::Text to render the output
+    /// of the text shaper, which works with glyph indices
+    /// rather than with code points.
+    ///
+    /// \param glyphIndex    Index of the glyph in the font face
+    /// \param characterSize Reference character size
+    /// \param bold          Retrieve the bold version or the regular one?
+    /// \param face          Face containing the glyph (0 for this font, n for the n-th fallback)
+    /// \param phase         Horizontal offset of the pen, in quarters of pixel (ignored without subpixel positioning)
+    ///
+    /// \return The glyph corresponding to \a glyphIndex and \a characterSize
+    ///
+    ////////////////////////////////////////////////////////////
+    const Glyph& getGlyphByIndex(Uint32 glyphIndex, unsigned int characterSize, bool bold, std::size_t face = 0, unsigned int phase = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Shape a string
+    ///
+    /// Shaping converts a sequence of code points to a sequence
+    /// of positioned glyphs, applying ligatures, contextual forms
+    /// and mark positioning as required by complex scripts.
+    /// Shaped strings are cached per character size, so that a
+    /// string is only shaped once as long as it stays in the cache.
+    /// The result is copied, since the cache may be modified by
+    /// other threads as soon as this function returns.
+    ///
+    /// Shaping is only available when SFML is built with
+    /// HarfBuzz support, and for scalable fonts.
+    ///
+    /// \param codePoints    Pointer to the code points of the string
+    /// \param count         Number of code points
+    /// \param characterSize Reference character size
+    /// \param bold          Shape the bold version or the regular one?
+    /// \param result        Receives the shaped string
+    ///
+    /// \return True if the string was shaped, false if shaping is not available
+    ///
+    ////////////////////////////////////////////////////////////
+    bool shape(const Uint32* codePoints, std::size_t count, unsigned int characterSize, bool bold, ShapedRun& result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a new glyph and store it in the cache
+    ///
+    /// The glyph is rendered from the face of \a source, which
+    /// is either this font or one of its fallbacks, and stored
+    /// in the texture of this font.
+    ///
+    /// \param source        Font containing the glyph
+    /// \param glyphIndex    Index of the glyph to load in the font face
+    /// \param characterSize Reference character size
+    /// \param bold          Retrieve the bold version or the regular one?
+    /// \param phase         Horizontal offset of the pen, in quarters of pixel (ignored without subpixel positioning)
+    ///
+    /// \return The glyph corresponding to \a glyphIndex and \a characterSize
+    ///
+    ////////////////////////////////////////////////////////////
+    Glyph loadGlyph(const Font& source, Uint32 glyphIndex, unsigned int characterSize, bool bold, unsigned int phase) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the pending glyphs of a page to its texture
+    ///
+    /// The texture is created or enlarged first if needed.
+    ///
+    /// \param page Page to update
+    ///
+    ////////////////////////////////////////////////////////////
+    void writePendingGlyphs(Page& page) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Find a suitable rectangle within the texture for a glyph
@@ -331,15 +589,19 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    void*                      m_library;     ///< Pointer to the internal library interface (it is typeless to avoid exposing implementation details)
-    void*                      m_face;        ///< Pointer to the internal font face (it is typeless to avoid exposing implementation details)
-    void*                      m_streamRec;   ///< Pointer to the stream rec instance (it is typeless to avoid exposing implementation details)
-    int*                       m_refCount;    ///< Reference counter used by implicit sharing
-    Info                       m_info;        ///< Information about the font
-    mutable PageTable          m_pages;       ///< Table containing the glyphs pages by character size
-    mutable std::vector<Uint8> m_pixelBuffer; ///< Pixel buffer holding a glyph's pixels before being written to the texture
+    void*                      m_library;             ///< Pointer to the internal library interface (it is typeless to avoid exposing implementation details)
+    void*                      m_face;                ///< Pointer to the internal font face (it is typeless to avoid exposing implementation details)
+    void*                      m_streamRec;           ///< Pointer to the stream rec instance (it is typeless to avoid exposing implementation details)
+    int*                       m_refCount;            ///< Reference counter used by implicit sharing
+    Info                       m_info;                ///< Information about the font
+    mutable PageTable          m_pages;               ///< Table containing the glyphs pages by character size
+    std::vector<const Font*>   m_fallbacks;           ///< Fonts used for the characters missing from this font
+    bool                       m_subpixelPositioning; ///< Are glyphs rendered for subpixel pen positions?
+    bool                       m_threadSafe;          ///< Are the accesses to the font serialized?
+    mutable Mutex              m_mutex;               ///< Mutex protecting the glyph cache in thread-safe mode
+    mutable Mutex              m_faceMutex;           ///< Mutex protecting the font face in thread-safe mode (no other mutex is locked while it is held)
     #ifdef SFML_SYSTEM_ANDROID
-    void*                      m_stream; ///< Asset file streamer (if loaded from file)
+    void*                      m_stream;              ///< Asset file streamer (if loaded from file)
     #endif
 };
 
@@ -412,6 +674,27 @@ private:
 /// with this class. However, it may be useful to access the
 /// font metrics or rasterized glyphs for advanced usage.
 ///
+/// Fonts rarely cover all the scripts used by an application
+/// (for example Latin, CJK and symbols). Instead of splitting
+/// strings into several sf::Text instances, other fonts can be
+/// registered as fallbacks: characters missing from a font are
+/// then taken from its fallbacks, but rendered into the texture
+/// of the font itself.
+/// \code
+/// sf::Font latin, cjk;
+/// latin.loadFromFile("DejaVuSans.ttf");
+/// cjk.loadFromFile("NotoSansCJK.otf");
+/// latin.addFallback(cjk);
+///
+/// sf::Text text(L"Hello \u4E16\u754C", latin); // still a single draw call
+/// \endcode
+///
+/// A font can be shared by several threads, for example to lay
+/// out long documents in parallel, if it is switched to the
+/// thread-safe mode (see setThreadSafe). In this mode, the glyphs
+/// loaded by worker threads are written to the texture by the
+/// thread which draws the texts.
+///
 /// Note that if the font is a bitmap font, it is not scalable,
 /// thus not all requested sizes will be available to use. This
 /// needs to be taken into consideration when using sf::Text.
@@ -0,0 +1,304 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_FRAMERECORDER_HPP
+#define SFML_FRAMERECORDER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Thread.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+namespace sf
+{
+class RenderWindow;
+
+////////////////////////////////////////////////////////////
+/// \brief Save captured frames to disk in a background thread
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API FrameRecorder : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enumeration of the output formats
+    ///
+    ////////////////////////////////////////////////////////////
+    enum Format
+    {
+        PngSequence, ///< One PNG file per frame
+        RawDump      ///< Raw RGBA pixels of all the frames, appended to a single file
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameRecorder();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Stops the recording, if any; the frames which are
+    /// still queued are saved before the destructor returns.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~FrameRecorder();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start recording
+    ///
+    /// With the PngSequence format, \a path is the prefix of
+    /// the files: the frame number (5 digits) and the ".png"
+    /// extension are appended to it. With the RawDump format,
+    /// \a path is the file to write.
+    ///
+    /// \a capacity is the number of frames that can be waiting
+    /// to be saved; when all of them are used, new captures are
+    /// dropped until the background thread catches up.
+    ///
+    /// If a recording is in progress, it is stopped first.
+    ///
+    /// \param path     Path of the output file(s)
+    /// \param format   Output format
+    /// \param capacity Maximum number of queued frames
+    /// \param settings Settings used to encode PNG files
+    ///
+    /// \return True if recording was successfully started
+    ///
+    /// \see stop
+    ///
+    ////////////////////////////////////////////////////////////
+    bool start(const std::string& path, Format format = PngSequence, std::size_t capacity = 4,
+               const Image::EncodingSettings& settings = Image::EncodingSettings());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop recording
+    ///
+    /// This function waits until all the queued frames
+    /// are saved.
+    ///
+    /// \see start
+    ///
+    ////////////////////////////////////////////////////////////
+    void stop();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a recording is in progress
+    ///
+    /// The recording stops by itself if a frame can't be saved
+    /// (for example when the disk is full); the frames which
+    /// were waiting in the queue are then counted as dropped.
+    ///
+    /// \return True if the recorder accepts captures
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isRecording() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Capture the current contents of a window
+    ///
+    /// The pixels are read into a queued frame, and converted
+    /// and saved by the background thread. Call this function
+    /// after drawing, before the window is displayed.
+    ///
+    /// Reading the pixels is synchronous: this function waits
+    /// until the GPU has finished rendering the frame, and for
+    /// the transfer of the pixels to the system memory.
+    ///
+    /// \param window Window to capture
+    ///
+    /// \return True if the frame was queued, false if it was dropped
+    ///
+    ////////////////////////////////////////////////////////////
+    bool capture(const RenderWindow& window);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Capture an image
+    ///
+    /// \param image Image to capture
+    ///
+    /// \return True if the frame was queued, false if it was dropped
+    ///
+    ////////////////////////////////////////////////////////////
+    bool capture(const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames saved since the recording started
+    ///
+    /// Only the frames which were successfully written are counted.
+    ///
+    /// \return Number of saved frames
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getSavedFrameCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames dropped since the recording started
+    ///
+    /// A frame is dropped when the queue is full, or when it
+    /// was still waiting to be saved when the recording stopped
+    /// after a failure.
+    ///
+    /// \return Number of dropped frames
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getDroppedFrameCount() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Captured frame
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Frame
+    {
+        std::vector<Uint8> pixels;  ///< RGBA pixels
+        Vector2u           size;    ///< Size of the frame, in pixels
+        bool               flipped; ///< Are the rows stored bottom to top?
+        unsigned int       number;  ///< Number of the frame in the recording
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the next free frame of the queue
+    ///
+    /// \return Free frame, or NULL if the queue is full
+    ///
+    ////////////////////////////////////////////////////////////
+    Frame* acquireFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add the frame returned by acquireFrame to the queue
+    ///
+    /// \return True if the frame was queued, false if the recording stopped meanwhile
+    ///
+    ////////////////////////////////////////////////////////////
+    bool queueFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the queued frames, until the recording stops
+    ///
+    /// This function runs in the background thread.
+    ///
+    ////////////////////////////////////////////////////////////
+    void saveFrames();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save a frame
+    ///
+    /// \param frame Frame to save
+    ///
+    /// \return True if the frame was written
+    ///
+    ////////////////////////////////////////////////////////////
+    bool saveFrame(Frame& frame);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Thread                  m_thread;        ///< Thread saving the frames
+    mutable Mutex           m_mutex;         ///< Mutex protecting the queue and the counters
+    bool                    m_isRecording;   ///< Recording state
+    std::string             m_path;          ///< Path of the output file(s)
+    Format                  m_format;        ///< Output format
+    Image::EncodingSettings m_settings;      ///< Settings used to encode PNG files
+    std::ofstream           m_file;          ///< Output file of the RawDump format
+    std::vector<Frame>      m_frames;        ///< Ring of frames, reused from one recording to the next
+    std::size_t             m_first;         ///< Index of the oldest queued frame
+    std::size_t             m_count;         ///< Number of queued frames
+    unsigned int            m_capturedCount; ///< Number of queued frames since the recording started
+    unsigned int            m_savedCount;    ///< Number of saved frames since the recording started
+    unsigned int            m_droppedCount;  ///< Number of dropped frames since the recording started
+};
+
+} // namespace sf
+
+
+#endif // SFML_FRAMERECORDER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FrameRecorder
+/// \ingroup graphics
+///
+/// Saving a screenshot with RenderWindow::capture and
+/// Image::saveToFile blocks the application while the
+/// image is encoded, which takes far longer than a frame.
+/// sf::FrameRecorder only reads the pixels in the calling
+/// thread, and leaves the conversion and the encoding to
+/// a background thread.
+///
+/// Capturing a window is still not free: reading its pixels
+/// makes the calling thread wait until the GPU has finished
+/// the frame, then copies the pixels to the system memory.
+/// This costs much less than encoding, but it removes the
+/// overlap between the CPU and the GPU for captured frames.
+///
+/// The captured frames are stored in a fixed ring of buffers,
+/// allocated once and reused for the following frames. When
+/// the background thread can't keep up and all the buffers
+/// are waiting to be saved, new captures are dropped instead
+/// of stalling the application; getDroppedFrameCount tells
+/// how many frames were lost.
+///
+/// The frames can be saved as a sequence of PNG files (use
+/// Image::EncodingSettings to trade size for speed), or as a
+/// single raw file, which is much faster to write and can be
+/// converted to a video afterwards (RGBA pixels, top to
+/// bottom, one frame after the other).
+///
+/// The capture functions must be called from a single thread,
+/// usually the one that draws.
+///
+/// Usage example:
+/// \code
+/// sf::FrameRecorder recorder;
+/// recorder.start("capture/frame", sf::FrameRecorder::PngSequence, 8, sf::Image::EncodingSettings(1));
+///
+/// while (window.isOpen())
+/// {
+///     ...
+///     window.clear();
+///     window.draw(scene);
+///     recorder.capture(window);
+///     window.display();
+/// }
+///
+/// recorder.stop();
+/// std::cout << recorder.getDroppedFrameCount() << " frames were dropped" << std::endl;
+/// \endcode
+///
+/// \see sf::RenderWindow, sf::Image
+///
+////////////////////////////////////////////////////////////
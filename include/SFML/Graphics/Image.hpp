@@ -47,6 +47,35 @@ class SFML_GRAPHICS_API Image
 {
 public:
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Settings used to encode an image
+    ///
+    ////////////////////////////////////////////////////////////
+    struct EncodingSettings
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// \param compression PNG compression level
+        /// \param jpegQuality JPEG quality
+        /// \param threads     Maximum number of threads used to encode PNG images
+        ///
+        ////////////////////////////////////////////////////////////
+        explicit EncodingSettings(int compression = 3, int jpegQuality = 90, unsigned int threads = 1) :
+        compressionLevel(compression),
+        quality         (jpegQuality),
+        threadCount     (threads)
+        {
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        int          compressionLevel; ///< PNG compression level, from 0 (fastest, no compression) to 9 (smallest file)
+        int          quality;          ///< JPEG quality, from 1 (smallest file) to 100 (best quality)
+        unsigned int threadCount;      ///< Maximum number of threads used to encode PNG images
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -150,11 +179,46 @@ public:
     ///
     /// \return True if saving was successful
     ///
-    /// \see create, loadFromFile, loadFromMemory
+    /// \see create, loadFromFile, loadFromMemory, saveToMemory
     ///
     ////////////////////////////////////////////////////////////
     bool saveToFile(const std::string& filename) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the image to a file on disk, with custom encoding settings
+    ///
+    /// This overload is the same as the one above, except that
+    /// the settings of the png and jpg encoders can be chosen.
+    ///
+    /// \param filename Path of the file to save
+    /// \param settings Encoding settings (used by png and jpg)
+    ///
+    /// \return True if saving was successful
+    ///
+    /// \see create, loadFromFile, loadFromMemory, saveToMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    bool saveToFile(const std::string& filename, const EncodingSettings& settings) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the image to a buffer in memory
+    ///
+    /// The supported image formats are png and jpg (which can
+    /// also be written "jpeg"). The \a output buffer is overwritten.
+    /// This function fails if the image is empty, or if \a format
+    /// is not supported.
+    ///
+    /// \param output   Buffer to fill with the encoded data
+    /// \param format   Encoding format to use ("png" or "jpg")
+    /// \param settings Encoding settings
+    ///
+    /// \return True if saving was successful
+    ///
+    /// \see create, loadFromMemory, saveToFile
+    ///
+    ////////////////////////////////////////////////////////////
+    bool saveToMemory(std::vector<Uint8>& output, const std::string& format, const EncodingSettings& settings = EncodingSettings()) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size (width and height) of the image
     ///
@@ -320,6 +384,11 @@ private:
 /// // Save the image to a file
 /// if (!image.saveToFile("result.png"))
 ///     return -1;
+///
+/// // Encode the image in memory, using 4 threads
+/// std::vector<sf::Uint8> png;
+/// if (!image.saveToMemory(png, "png", sf::Image::EncodingSettings(3, 90, 4)))
+///     return -1;
 /// \endcode
 ///
 /// \see sf::Texture
@@ -0,0 +1,289 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_PARTICLESYSTEM_HPP
+#define SFML_PARTICLESYSTEM_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Time.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Drawable set of simple, independent particles
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ParticleSystem : public Drawable, public Transformable, NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty particle system, without texture.
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the texture of the particles
+    ///
+    /// The \a texture argument refers to a texture that must
+    /// exist as long as the particle system uses it. If \a texture
+    /// is NULL, the particles are drawn as plain colored quads.
+    ///
+    /// \param texture Texture shared by all the particles
+    ///
+    /// \see getTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture* texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture of the particles
+    ///
+    /// \return Pointer to the texture, or NULL if there's none
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the acceleration applied to all the particles
+    ///
+    /// This is typically used for gravity or wind.
+    /// The default acceleration is (0, 0).
+    ///
+    /// \param acceleration Acceleration, in units per second squared
+    ///
+    /// \see getAcceleration
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAcceleration(const Vector2f& acceleration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the acceleration applied to all the particles
+    ///
+    /// \return Acceleration, in units per second squared
+    ///
+    /// \see setAcceleration
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2f& getAcceleration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of threads used to update the particles
+    ///
+    /// With a count greater than 1, update splits the particles
+    /// between the calling thread and count - 1 worker threads.
+    /// Threads are only used when there are enough particles
+    /// for each of them, so that small systems don't pay the
+    /// cost of synchronizing them. The worker threads are shared
+    /// with the rest of the graphics module and kept alive
+    /// between updates.
+    /// The default count is 1: everything runs in the calling thread.
+    ///
+    /// \param count Number of threads, including the calling thread
+    ///
+    /// \see getThreadCount
+    ///
+    ////////////////////////////////////////////////////////////
+    void setThreadCount(unsigned int count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads used to update the particles
+    ///
+    /// \return Number of threads, including the calling thread
+    ///
+    /// \see setThreadCount
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getThreadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Emit a new particle
+    ///
+    /// The particle is a quad centered on \a position. Like
+    /// with sf::Sprite, \a textureRect defines both the area of
+    /// the texture to display and the size of the quad.
+    ///
+    /// \param position    Initial position of the center of the particle
+    /// \param velocity    Initial velocity, in units per second
+    /// \param lifetime    Time after which the particle is removed
+    /// \param textureRect Area of the texture, and size of the particle
+    /// \param color       Color of the particle
+    ///
+    ////////////////////////////////////////////////////////////
+    void emit(const Vector2f& position, const Vector2f& velocity, Time lifetime, const IntRect& textureRect, const Color& color = Color::White);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the particles
+    ///
+    /// This function moves the particles according to their
+    /// velocity and the acceleration, removes the ones whose
+    /// lifetime is over and rebuilds the geometry.
+    ///
+    /// \param elapsed Time elapsed since the last update
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Time elapsed);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of alive particles
+    ///
+    /// \return Number of particles
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getParticleCount() const;
+
+private:
+
+    struct UpdateTask;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the particles to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move a range of particles and rebuild their geometry
+    ///
+    /// Ranges are independent, so that they can be updated in
+    /// parallel.
+    ///
+    /// \param begin Index of the first particle
+    /// \param end   Index after the last particle
+    /// \param dt    Time elapsed, in seconds
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateRange(std::size_t begin, std::size_t end, float dt);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the vertices of a range of particles
+    ///
+    /// \param begin Index of the first particle
+    /// \param end   Index after the last particle
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateVertices(std::size_t begin, std::size_t end);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a particle
+    ///
+    /// The last particle takes its place, so that the arrays
+    /// remain packed.
+    ///
+    /// \param index Index of the particle to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Texture*       m_texture;      ///< Texture of the particles
+    Vector2f             m_acceleration; ///< Acceleration applied to all the particles
+    unsigned int         m_threadCount;  ///< Number of threads used by update
+    std::vector<float>   m_positionsX;   ///< Horizontal position of each particle
+    std::vector<float>   m_positionsY;   ///< Vertical position of each particle
+    std::vector<float>   m_velocitiesX;  ///< Horizontal velocity of each particle
+    std::vector<float>   m_velocitiesY;  ///< Vertical velocity of each particle
+    std::vector<float>   m_lifetimes;    ///< Remaining lifetime of each particle, in seconds
+    std::vector<Color>   m_colors;       ///< Color of each particle
+    std::vector<IntRect> m_textureRects; ///< Texture rectangle of each particle
+    std::vector<Vertex>  m_vertices;     ///< Geometry of all the particles, as triangles
+};
+
+} // namespace sf
+
+
+#endif // SFML_PARTICLESYSTEM_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ParticleSystem
+/// \ingroup graphics
+///
+/// sf::ParticleSystem is a drawable class designed for large
+/// numbers of simple particles: sparks, smoke, rain, debris...
+///
+/// Rather than one object per particle, each with its own
+/// transform, the particle system stores every attribute
+/// in its own packed array (positions, velocities, lifetimes,
+/// colors and texture rectangles). Updating the particles
+/// is then a set of tight loops over contiguous memory, which
+/// compilers can vectorize, and which can be split between
+/// several threads (see setThreadCount).
+///
+/// The geometry of all the particles is stored in a single
+/// vertex array, which is drawn in one call. All the particles
+/// therefore share the same texture, use a texture atlas
+/// and texture rectangles if different images are needed.
+///
+/// sf::ParticleSystem inherits sf::Transformable: its
+/// transformations apply to all the particles at once.
+///
+/// Usage example:
+/// \code
+/// sf::ParticleSystem particles;
+/// particles.setTexture(&texture);
+/// particles.setAcceleration(sf::Vector2f(0, 98));
+/// particles.setThreadCount(4);
+///
+/// // In the main loop
+/// for (int i = 0; i < 100; ++i)
+///     particles.emit(emitterPosition, randomVelocity(), sf::seconds(2), sf::IntRect(0, 0, 8, 8));
+///
+/// particles.update(clock.restart());
+/// window.draw(particles);
+/// \endcode
+///
+/// \see sf::VertexArray, sf::Sprite
+///
+////////////////////////////////////////////////////////////
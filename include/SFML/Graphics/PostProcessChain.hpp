@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_POSTPROCESSCHAIN_HPP
+#define SFML_POSTPROCESSCHAIN_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class RenderTexture;
+class Shader;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Sequence of fullscreen shader passes applied
+///        to a texture
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API PostProcessChain : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty chain, which doesn't modify its input.
+    ///
+    ////////////////////////////////////////////////////////////
+    PostProcessChain();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~PostProcessChain();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a pass at the end of the chain
+    ///
+    /// The pass draws a fullscreen quad with \a shader, textured
+    /// with the output of the previous pass (or with the input
+    /// of the chain for the first pass). The shader accesses it
+    /// through the variable that was assigned Shader::CurrentTexture.
+    ///
+    /// The size of the output of the pass is the size of the
+    /// input of the chain multiplied by \a scale; use a scale
+    /// lower than 1 for passes that can run at a lower
+    /// resolution, such as blurs.
+    ///
+    /// The shader is not copied, it must remain alive as long
+    /// as the chain uses it.
+    ///
+    /// \param shader Shader that implements the pass
+    /// \param scale  Size of the output, relative to the input of the chain
+    ///
+    /// \return Index of the new pass
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t addPass(const Shader& shader, float scale = 1.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of passes of the chain
+    ///
+    /// \return Number of passes
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getPassCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the passes of the chain
+    ///
+    /// The render-textures used by the passes are kept for
+    /// the passes which may be added afterwards.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Force all the passes to run on the next call to apply
+    ///
+    /// The chain detects by itself the modifications of its
+    /// input, of the shaders and of their parameters. This
+    /// function is only needed when a texture used by a shader
+    /// is modified with direct OpenGL calls.
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the passes of the chain on a texture
+    ///
+    /// A pass only runs if its input, its shader, the parameters
+    /// or the textures of the shader changed since its previous
+    /// execution; otherwise its previous output is reused as is.
+    ///
+    /// The returned texture belongs to the chain, it remains
+    /// valid until the next call to apply, clear or addPass.
+    ///
+    /// \param input Texture to process
+    ///
+    /// \return Output of the last pass, or \a input if the chain is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& apply(const Texture& input);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take a render-texture of the given size from the pool
+    ///
+    /// A new render-texture is created if none of the free
+    /// ones has the requested size.
+    ///
+    /// \param size Size of the render-texture
+    ///
+    /// \return Render-texture, or NULL if it couldn't be created
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexture* acquireTarget(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a render-texture back to the pool
+    ///
+    /// \param target Render-texture to release
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseTarget(RenderTexture* target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Single step of the chain
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Pass
+    {
+        const Shader*  shader;       ///< Shader that implements the pass
+        float          scale;        ///< Size of the output, relative to the input of the chain
+        RenderTexture* target;       ///< Render-texture that holds the output of the pass
+        Uint64         inputId;      ///< Cache identifier of the input at the last execution
+        Uint64         programId;    ///< Cache identifier of the shader at the last execution
+        Uint64         parametersId; ///< Identifier of the shader parameters at the last execution
+        Uint64         texturesId;   ///< Identifier of the shader textures at the last execution
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Pass>           m_passes;  ///< Passes of the chain, in execution order
+    std::vector<RenderTexture*> m_pool;    ///< Free render-textures, from the least to the most recently released
+    Vertex                      m_quad[4]; ///< Fullscreen quad shared by all the passes
+};
+
+} // namespace sf
+
+
+#endif // SFML_POSTPROCESSCHAIN_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PostProcessChain
+/// \ingroup graphics
+///
+/// sf::PostProcessChain applies a sequence of fullscreen
+/// shader passes, such as blurs, color grading or tone mapping,
+/// to a texture -- typically the texture of a sf::RenderTexture
+/// in which the scene was drawn.
+///
+/// The chain owns the render-textures that store the
+/// intermediate results. They are taken from a pool and
+/// reused as long as their size matches: passes of the same
+/// size share free render-textures, and going back to a
+/// previous size (when the window is resized back and forth,
+/// for example) doesn't create new ones.
+///
+/// Each pass remembers what it was computed from. If neither
+/// its input nor its shader changed since the last call to
+/// apply, the pass is skipped and its previous output is used;
+/// a static scene with static effects is therefore processed
+/// only once.
+///
+/// Usage example:
+/// \code
+/// // Load the shaders; each one reads its input from the current texture
+/// sf::Shader blur, bloom;
+/// blur.loadFromFile("blur.frag", sf::Shader::Fragment);
+/// blur.setParameter("texture", sf::Shader::CurrentTexture);
+/// bloom.loadFromFile("bloom.frag", sf::Shader::Fragment);
+/// bloom.setParameter("texture", sf::Shader::CurrentTexture);
+/// bloom.setParameter("scene", scene.getTexture());
+///
+/// // Blur at half resolution, then combine with the original scene
+/// sf::PostProcessChain chain;
+/// chain.addPass(blur, 0.5f);
+/// chain.addPass(bloom);
+///
+/// // In the main loop, after drawing the scene into the render-texture
+/// scene.display();
+/// sf::Sprite sprite(chain.apply(scene.getTexture()));
+/// window.draw(sprite);
+/// \endcode
+///
+/// \see sf::Shader, sf::RenderTexture
+///
+////////////////////////////////////////////////////////////
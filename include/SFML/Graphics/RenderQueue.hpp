@@ -0,0 +1,265 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_RENDERQUEUE_HPP
+#define SFML_RENDERQUEUE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Render target that records draws, and submits them
+///        to another target sorted by render states
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderQueue : public RenderTarget
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics about the last submission
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        unsigned int commandCount;      ///< Number of draws recorded
+        unsigned int drawCallCount;     ///< Number of draw calls actually submitted
+        unsigned int stateChanges;      ///< Number of render states changes, after sorting
+        unsigned int stateChangesSaved; ///< Number of render states changes avoided by sorting
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty queue, with a size of 0x0.
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderQueue();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty queue with a size
+    ///
+    /// \param size Size of the queue, see setSize
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit RenderQueue(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the size of the queue
+    ///
+    /// The queue doesn't own any pixel, but its size defines
+    /// the default view, which drawables may use (to skip
+    /// what is not visible, for example). It should match
+    /// the size of the target the queue is submitted to.
+    ///
+    /// This function resets the current view to the new default view.
+    ///
+    /// \param size New size of the queue
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSize(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the queue
+    ///
+    /// \return Size of the queue
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the layer of the next draws
+    ///
+    /// Layers are submitted in increasing order: everything
+    /// drawn in a layer appears above the lower layers. Inside
+    /// a layer, the draws are reordered to group the ones that
+    /// share the same shader, texture and blend mode; they must
+    /// therefore not depend on their drawing order (i.e. not
+    /// overlap, or be opaque and use the same texture).
+    ///
+    /// The default layer is 0.
+    ///
+    /// \param layer Layer of the next draws
+    ///
+    /// \see getLayer
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLayer(int layer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layer of the next draws
+    ///
+    /// \return Current layer
+    ///
+    /// \see setLayer
+    ///
+    ////////////////////////////////////////////////////////////
+    int getLayer() const;
+
+    using RenderTarget::draw;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record primitives defined by an array of vertices
+    ///
+    /// The vertices are copied and transformed right away, so
+    /// that the source array can be modified or destroyed after
+    /// this call, and so that draws with different transforms
+    /// can be merged into a single draw call.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(const Vertex* vertices, std::size_t vertexCount,
+                      PrimitiveType type, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sort the recorded draws and submit them to a target
+    ///
+    /// The draws are sorted by layer, then by shader, texture
+    /// and blend mode, and consecutive draws which share the
+    /// same states are merged. The queue is empty after this call.
+    ///
+    /// Shaders are used with the parameters they have when
+    /// this function is called, not when the draws were recorded.
+    ///
+    /// \param target Target to draw to
+    ///
+    ////////////////////////////////////////////////////////////
+    void submit(RenderTarget& target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get statistics about the last submission
+    ///
+    /// \return Statistics of the last call to submit
+    ///
+    ////////////////////////////////////////////////////////////
+    const Statistics& getStatistics() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate the target for rendering
+    ///
+    /// The queue has no OpenGL context: this function always
+    /// fails, so that the functions of sf::RenderTarget which
+    /// use OpenGL directly (clear, pushGLStates, ...) do nothing.
+    ///
+    /// \param active True to activate, false to deactivate
+    ///
+    /// \return Always false
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool activate(bool active);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recorded draw
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Command
+    {
+        int            layer;     ///< Layer of the draw
+        const Shader*  shader;    ///< Shader of the draw
+        const Texture* texture;   ///< Texture of the draw
+        BlendMode      blendMode; ///< Blend mode of the draw
+        PrimitiveType  type;      ///< Type of primitives (never a strip or a fan)
+        std::size_t    first;     ///< Index of the first vertex in the vertex storage
+        std::size_t    count;     ///< Number of vertices
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u             m_size;       ///< Size of the queue
+    int                  m_layer;      ///< Layer of the next draws
+    std::vector<Command> m_commands;   ///< Draws recorded since the last submission
+    std::vector<Vertex>  m_vertices;   ///< Transformed vertices of the recorded draws
+    std::vector<Vertex>  m_batch;      ///< Vertices of the batch being submitted
+    Statistics           m_statistics; ///< Statistics of the last submission
+};
+
+} // namespace sf
+
+
+#endif // SFML_RENDERQUEUE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderQueue
+/// \ingroup graphics
+///
+/// Every change of shader, texture or blend mode between
+/// two draws costs a state change and a separate draw call.
+/// When entities that use different textures are interleaved,
+/// the render target can't avoid them, because the drawing
+/// order defines what appears on top.
+///
+/// sf::RenderQueue is a render target which doesn't draw
+/// anything itself: it records the draws, each one with a
+/// layer. When the queue is submitted to a real target,
+/// the draws are sorted by layer, then inside each layer by
+/// shader, texture and blend mode; consecutive draws with
+/// the same states are merged into a single draw call.
+///
+/// The layers are the way to keep control of the drawing
+/// order: whatever must appear on top of something else
+/// must be drawn in a higher layer.
+///
+/// Usage example:
+/// \code
+/// sf::RenderQueue queue(window.getSize());
+///
+/// // In the main loop
+/// queue.setLayer(0);
+/// queue.draw(background);
+///
+/// queue.setLayer(1);
+/// for (std::size_t i = 0; i < entities.size(); ++i)
+///     queue.draw(entities[i]); // any texture, in any order
+///
+/// queue.setLayer(2);
+/// queue.draw(hud);
+///
+/// window.clear();
+/// queue.submit(window);
+/// window.display();
+/// \endcode
+///
+/// The view of the queue is only seen by the drawables that
+/// query it while they are recorded; the draws are submitted
+/// with the current view of the destination target.
+///
+/// \see sf::RenderTarget
+///
+////////////////////////////////////////////////////////////
@@ -63,11 +63,13 @@ public:
     ///
     /// This function is usually called once every frame,
     /// to clear the previous contents of the target.
+    /// It is virtual so that targets which don't render with
+    /// OpenGL, such as sf::SoftwareRenderTarget, can implement it.
     ///
     /// \param color Fill color to use to clear the render target
     ///
     ////////////////////////////////////////////////////////////
-    void clear(const Color& color = Color(0, 0, 0, 255));
+    virtual void clear(const Color& color = Color(0, 0, 0, 255));
 
     ////////////////////////////////////////////////////////////
     /// \brief Change the current active view
@@ -238,14 +240,18 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Draw primitives defined by an array of vertices
     ///
+    /// All the drawing functions end up calling this one. It is
+    /// virtual so that targets which don't render directly with
+    /// OpenGL, such as sf::RenderQueue, can record the primitives instead.
+    ///
     /// \param vertices    Pointer to the vertices
     /// \param vertexCount Number of vertices in the array
     /// \param type        Type of primitives to draw
     /// \param states      Render states to use for drawing
     ///
     ////////////////////////////////////////////////////////////
-    void draw(const Vertex* vertices, std::size_t vertexCount,
-              PrimitiveType type, const RenderStates& states = RenderStates::Default);
+    virtual void draw(const Vertex* vertices, std::size_t vertexCount,
+                      PrimitiveType type, const RenderStates& states = RenderStates::Default);
 
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
@@ -284,6 +290,13 @@ public:
     /// saved and restored). Take a look at the resetGLStates
     /// function if you do so.
     ///
+    /// Note that the shader program used by the last draw call
+    /// stays bound when draw returns, so that consecutive draws
+    /// with the same shader don't bind it again; popGLStates
+    /// unbinds it. OpenGL code which runs after SFML drawing
+    /// without these functions must bind its own program (or
+    /// the program 0) before rendering.
+    ///
     /// \see popGLStates
     ///
     ////////////////////////////////////////////////////////////
@@ -309,6 +322,9 @@ public:
     /// states needed by SFML are set, so that subsequent draw()
     /// calls will work as expected.
     ///
+    /// It also unbinds the shader program, which stays bound
+    /// after a draw call that used a shader.
+    ///
     /// Example:
     /// \code
     /// // OpenGL code here...
@@ -394,6 +410,19 @@ private:
     ////////////////////////////////////////////////////////////
     virtual bool activate(bool active) = 0;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate the target and keep the states cache valid
+    ///
+    /// Several targets can render in the same context (render
+    /// textures use the active one), so when another target
+    /// used the context since our last draw, the OpenGL states
+    /// no longer match the cache and must be set again.
+    ///
+    /// \return True if the target was activated
+    ///
+    ////////////////////////////////////////////////////////////
+    bool activateContext();
+
     ////////////////////////////////////////////////////////////
     /// \brief Render states cache
     ///
@@ -402,12 +431,18 @@ private:
     {
         enum {VertexCacheSize = 4};
 
-        bool      glStatesSet;    ///< Are our internal GL states set yet?
-        bool      viewChanged;    ///< Has the current view changed since last draw?
-        BlendMode lastBlendMode;  ///< Cached blending mode
-        Uint64    lastTextureId;  ///< Cached texture
-        bool      useVertexCache; ///< Did we previously use the vertex cache?
+        bool      glStatesSet;          ///< Are our internal GL states set yet?
+        bool      viewChanged;          ///< Has the current view changed since last draw?
+        BlendMode lastBlendMode;        ///< Cached blending mode
+        Uint64    lastTextureId;        ///< Cached texture
+        bool      textureMatrixSet;     ///< Is the cached texture matrix loaded?
+        float     textureMatrix[16];    ///< Cached texture matrix
+        Uint64    lastShaderId;         ///< Cached shader program
+        Uint64    lastShaderTexturesId; ///< Cached texture bindings of the shader
+        bool      useVertexCache;       ///< Did we previously use the vertex cache?
         Vertex    vertexCache[VertexCacheSize]; ///< Pre-transformed vertices cache
+        Uint64    contextId;            ///< Context of the last draw
+        Uint64*   contextTarget;        ///< Last target that rendered in this context
     };
 
     ////////////////////////////////////////////////////////////
@@ -416,6 +451,7 @@ private:
     View        m_defaultView; ///< Default view
     View        m_view;        ///< Current view
     StatesCache m_cache;       ///< Render states cache
+    Uint64      m_id;          ///< Unique number that identifies the target
 };
 
 } // namespace sf
@@ -444,7 +480,8 @@ private:
 /// OpenGL stuff. It is even possible to mix together OpenGL calls
 /// and regular SFML drawing commands. When doing so, make sure that
 /// OpenGL states are not messed up by calling the
-/// pushGLStates/popGLStates functions.
+/// pushGLStates/popGLStates functions. Be aware that the shader
+/// program of the last draw call stays bound after it returns.
 ///
 /// \see sf::RenderWindow, sf::RenderTexture, sf::View
 ///
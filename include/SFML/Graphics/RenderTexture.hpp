@@ -31,6 +31,7 @@
 #include <SFML/Graphics/Export.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Window/ContextSettings.hpp>
 
 
 namespace sf
@@ -85,6 +86,39 @@ public:
     ////////////////////////////////////////////////////////////
     bool create(unsigned int width, unsigned int height, bool depthBuffer = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the render-texture with additional settings
+    ///
+    /// This overload gives access to more options than the
+    /// previous one: a depth buffer is created if
+    /// settings.depthBits is not 0, and settings.antialiasingLevel
+    /// is the number of samples per pixel used for antialiasing.
+    /// Antialiased render-textures draw into a multisampled
+    /// buffer, which is resolved into the target texture by
+    /// display() if anything was drawn since the last call.
+    ///
+    /// If the requested antialiasing level is not supported,
+    /// the highest available one is used instead (see
+    /// getMaximumAntialiasingLevel). Other members of \a settings
+    /// are ignored.
+    ///
+    /// \param width    Width of the render-texture
+    /// \param height   Height of the render-texture
+    /// \param settings Additional settings for the underlying buffers
+    ///
+    /// \return True if creation has been successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool create(unsigned int width, unsigned int height, const ContextSettings& settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum antialiasing level supported by render-textures
+    ///
+    /// \return Maximum number of samples per pixel, 0 if antialiasing is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    static unsigned int getMaximumAntialiasingLevel();
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable texture smoothing
     ///
@@ -275,6 +309,14 @@ private:
 /// and regular SFML drawing commands. If you need a depth buffer for
 /// 3D rendering, don't forget to request it when calling RenderTexture::create.
 ///
+/// Render-textures can also be antialiased, which is much cheaper
+/// than rendering at a higher resolution and downscaling:
+/// \code
+/// sf::ContextSettings settings;
+/// settings.antialiasingLevel = 4;
+/// texture.create(500, 500, settings);
+/// \endcode
+///
 /// \see sf::RenderTarget, sf::RenderWindow, sf::View, sf::Texture
 ///
 ////////////////////////////////////////////////////////////
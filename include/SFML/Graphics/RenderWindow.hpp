@@ -37,6 +37,11 @@
 
 namespace sf
 {
+namespace priv
+{
+    struct FrameBufferBinding;
+}
+
 ////////////////////////////////////////////////////////////
 /// \brief Window that can serve as a target for 2D drawing
 ///
@@ -112,6 +117,30 @@ public:
     ////////////////////////////////////////////////////////////
     virtual Vector2u getSize() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate or deactivate the window as the current target
+    ///        for OpenGL rendering
+    ///
+    /// This function hides sf::Window::setActive: in addition,
+    /// it makes sure that the frame buffer of the window is
+    /// bound, since render textures may have bound their own
+    /// one in the context of the window. Use this version before
+    /// issuing custom OpenGL calls that target the window.
+    ///
+    /// sf::Window::setActive is not virtual: when it is called
+    /// through a reference or a pointer to sf::Window, the frame
+    /// buffer of the last render texture used in the context of
+    /// the window may stay bound, and custom OpenGL calls would
+    /// then render to that texture. Drawing with SFML is not
+    /// affected, the window always restores its own frame buffer.
+    ///
+    /// \param active True to activate, false to deactivate
+    ///
+    /// \return True if operation was successful, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    bool setActive(bool active = true) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy the current contents of the window to an image
     ///
@@ -160,6 +189,12 @@ private:
     ///
     ////////////////////////////////////////////////////////////
     virtual bool activate(bool active);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    mutable Uint64                    m_contextId;          ///< Context of the last activation
+    mutable priv::FrameBufferBinding* m_frameBufferBinding; ///< Frame buffer binding of this context
 };
 
 } // namespace sf
@@ -37,6 +37,7 @@
 #include <SFML/System/Vector3.hpp>
 #include <map>
 #include <string>
+#include <vector>
 
 
 namespace sf
@@ -44,6 +45,11 @@ namespace sf
 class InputStream;
 class Texture;
 
+namespace priv
+{
+    class ResourceAccess;
+}
+
 ////////////////////////////////////////////////////////////
 /// \brief Shader class (vertex and fragment)
 ///
@@ -456,6 +462,138 @@ public:
     ////////////////////////////////////////////////////////////
     void setParameter(const std::string& name, CurrentTextureType);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a handle to a uniform variable of the shader
+    ///
+    /// The returned handle can be passed to the setUniform
+    /// functions, which avoid the name lookup and the program
+    /// switch that setParameter performs on every call. Handles
+    /// stay valid until the shader is loaded again.
+    ///
+    /// Example:
+    /// \code
+    /// int offset = shader.getUniformHandle("offset");
+    /// ...
+    /// shader.setUniform(offset, 2.f);
+    /// \endcode
+    ///
+    /// \param name Name of the variable in the shader
+    ///
+    /// \return Handle of the variable, or -1 if not found
+    ///
+    /// \see setUniform
+    ///
+    ////////////////////////////////////////////////////////////
+    int getUniformHandle(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a float uniform of the shader
+    ///
+    /// The value is stored on the client side and uploaded
+    /// the next time the shader is bound, only if it changed
+    /// since the last upload. The corresponding variable in
+    /// the shader must be a float (float GLSL type).
+    ///
+    /// Values assigned with setParameter are uploaded immediately
+    /// and are not tracked: don't mix both APIs on the same variable.
+    ///
+    /// \param handle Handle of the variable, as returned by getUniformHandle
+    /// \param x      Value to assign
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(int handle, float x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a 2-components vector uniform of the shader
+    ///
+    /// The corresponding variable in the shader must be a
+    /// 2x1 vector (vec2 GLSL type).
+    ///
+    /// \param handle Handle of the variable, as returned by getUniformHandle
+    /// \param x      First component of the value to assign
+    /// \param y      Second component of the value to assign
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(int handle, float x, float y);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a 3-components vector uniform of the shader
+    ///
+    /// The corresponding variable in the shader must be a
+    /// 3x1 vector (vec3 GLSL type).
+    ///
+    /// \param handle Handle of the variable, as returned by getUniformHandle
+    /// \param x      First component of the value to assign
+    /// \param y      Second component of the value to assign
+    /// \param z      Third component of the value to assign
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(int handle, float x, float y, float z);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a 4-components vector uniform of the shader
+    ///
+    /// The corresponding variable in the shader must be a
+    /// 4x1 vector (vec4 GLSL type).
+    ///
+    /// \param handle Handle of the variable, as returned by getUniformHandle
+    /// \param x      First component of the value to assign
+    /// \param y      Second component of the value to assign
+    /// \param z      Third component of the value to assign
+    /// \param w      Fourth component of the value to assign
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(int handle, float x, float y, float z, float w);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a 2-components vector uniform of the shader
+    ///
+    /// The corresponding variable in the shader must be a
+    /// 2x1 vector (vec2 GLSL type).
+    ///
+    /// \param handle Handle of the variable, as returned by getUniformHandle
+    /// \param vector Vector to assign
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(int handle, const Vector2f& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a 3-components vector uniform of the shader
+    ///
+    /// The corresponding variable in the shader must be a
+    /// 3x1 vector (vec3 GLSL type).
+    ///
+    /// \param handle Handle of the variable, as returned by getUniformHandle
+    /// \param vector Vector to assign
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(int handle, const Vector3f& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a color uniform of the shader
+    ///
+    /// The corresponding variable in the shader must be a
+    /// 4x1 vector (vec4 GLSL type). The color components are
+    /// normalized to the [0, 1] range, like in setParameter.
+    ///
+    /// \param handle Handle of the variable, as returned by getUniformHandle
+    /// \param color  Color to assign
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(int handle, const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a matrix uniform of the shader
+    ///
+    /// The corresponding variable in the shader must be a
+    /// 4x4 matrix (mat4 GLSL type).
+    ///
+    /// \param handle    Handle of the variable, as returned by getUniformHandle
+    /// \param transform Transform to assign
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(int handle, const sf::Transform& transform);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the underlying OpenGL handle of the shader.
     ///
@@ -506,8 +644,30 @@ public:
     ////////////////////////////////////////////////////////////
     static bool isAvailable();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the directory of the program binary cache
+    ///
+    /// When a directory is set, the linked programs are saved
+    /// into it in the driver's binary format, and the load
+    /// functions reuse them instead of compiling the same
+    /// source code again. Entries are keyed by the source code
+    /// and tied to the OpenGL vendor, renderer and version: they
+    /// are automatically rebuilt when the driver changes.
+    ///
+    /// The cache requires the ARB_get_program_binary extension;
+    /// when it is not available, shaders are simply compiled as usual.
+    /// The directory must already exist. The cache is disabled
+    /// by default, pass an empty string to disable it again.
+    ///
+    /// \param directory Path of the directory where binaries are stored
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setBinaryCacheDirectory(const std::string& directory);
+
 private:
 
+    friend class priv::ResourceAccess;
+
     ////////////////////////////////////////////////////////////
     /// \brief Compile the shader(s) and create the program
     ///
@@ -531,6 +691,19 @@ private:
     ////////////////////////////////////////////////////////////
     void bindTextures() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get an identifier of the current texture bindings
+    ///
+    /// The identifier changes whenever bindTextures would
+    /// produce a different result: a texture variable was
+    /// assigned, or one of the textures was modified or
+    /// replaced. It is used by the states cache of sf::RenderTarget.
+    ///
+    /// \return Identifier of the texture bindings
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint64 getTexturesCacheId() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the location ID of a shader parameter
     ///
@@ -541,19 +714,58 @@ private:
     ////////////////////////////////////////////////////////////
     int getParamLocation(const std::string& name);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Store the value of a uniform on the client side
+    ///
+    /// The uniform is flagged for upload only if its value
+    /// actually changed.
+    ///
+    /// \param handle Handle of the uniform
+    /// \param values Pointer to the components to store
+    /// \param count  Number of components (1, 2, 3, 4 or 16)
+    ///
+    ////////////////////////////////////////////////////////////
+    void storeUniform(int handle, const float* values, unsigned int count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the uniforms which changed since the last upload
+    ///
+    /// The shader program must be bound when this function is called.
+    ///
+    ////////////////////////////////////////////////////////////
+    void uploadUniforms() const;
+
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
     typedef std::map<int, const Texture*> TextureTable;
     typedef std::map<std::string, int> ParamTable;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Client-side copy of a uniform variable
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Uniform
+    {
+        int          location;   ///< Location of the variable in the shader
+        unsigned int count;      ///< Number of components stored in values
+        float        values[16]; ///< Last value assigned to the variable
+        bool         dirty;      ///< Does the value need to be uploaded?
+    };
+
+    typedef std::vector<Uniform> UniformArray;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int m_shaderProgram;  ///< OpenGL identifier for the program
-    int          m_currentTexture; ///< Location of the current texture in the shader
-    TextureTable m_textures;       ///< Texture variables in the shader, mapped to their location
-    ParamTable   m_params;         ///< Parameters location cache
+    unsigned int         m_shaderProgram;  ///< OpenGL identifier for the program
+    int                  m_currentTexture; ///< Location of the current texture in the shader
+    TextureTable         m_textures;       ///< Texture variables in the shader, mapped to their location
+    ParamTable           m_params;         ///< Parameters location cache
+    mutable UniformArray m_uniforms;       ///< Client-side storage of the uniforms, indexed by handle
+    mutable bool         m_uniformsDirty;  ///< Does at least one uniform need to be uploaded?
+    Uint64               m_cacheId;        ///< Unique number that identifies the program, for the states cache
+    Uint64               m_parametersId;   ///< Incremented whenever a parameter value is modified, starts from m_cacheId
 };
 
 } // namespace sf
@@ -603,6 +815,17 @@ private:
 /// shader.setParameter("texture", sf::Shader::CurrentTexture);
 /// \endcode
 ///
+/// When the same variables are updated very often (for
+/// example for every object, every frame), it is faster
+/// to retrieve a handle once and then use setUniform. The
+/// values are kept on the client side and only those which
+/// changed are uploaded, when the shader is bound for drawing:
+/// \code
+/// int offset = shader.getUniformHandle("offset");
+/// ...
+/// shader.setUniform(offset, 2.f);
+/// \endcode
+///
 /// The special Shader::CurrentTexture argument maps the
 /// given texture variable to the current texture of the
 /// object being drawn (which cannot be known in advance).
@@ -647,6 +870,15 @@ private:
 /// second one doesn't impact the rendering process and can be
 /// easily inserted anywhere without impacting all the code.
 ///
+/// Compiling many shaders can take a significant part of the
+/// startup time of an application. If the driver supports it,
+/// the linked programs can be stored on disk and reused by the
+/// next runs:
+/// \code
+/// sf::Shader::setBinaryCacheDirectory("cache/shaders");
+/// shader.loadFromFile("blur.vert", "blur.frag"); // compiled once, then loaded from the cache
+/// \endcode
+///
 /// Like sf::Texture that can be used as a raw OpenGL texture,
 /// sf::Shader can also be used directly as a raw shader for
 /// custom OpenGL geometry.
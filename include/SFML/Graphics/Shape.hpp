@@ -265,6 +265,28 @@ protected:
     ////////////////////////////////////////////////////////////
     void update();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the internal geometry of the shape from a unit geometry
+    ///
+    /// This variant of update is meant for shapes whose points
+    /// only depend on a size, such as circles or rectangles.
+    /// \a points define the shape for a size of 1x1, and
+    /// \a scale is applied when the shape is rendered rather
+    /// than to each point. The points are not copied: they
+    /// must remain alive and unchanged as long as the shape
+    /// uses them, which makes it possible to compute them once
+    /// and share them between all the shapes of the same kind.
+    ///
+    /// When the same points are passed again, only the scale
+    /// is updated, which is almost free.
+    ///
+    /// \param points Points of the shape, for a size of 1x1
+    /// \param count  Number of points
+    /// \param scale  Actual size of the shape
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const Vector2f* points, std::size_t count, const Vector2f& scale);
+
 private:
 
     ////////////////////////////////////////////////////////////
@@ -276,6 +298,16 @@ private:
     ////////////////////////////////////////////////////////////
     virtual void draw(RenderTarget& target, RenderStates states) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the attributes that depend on the fill positions
+    ///
+    /// This function computes the center, the bounds, the colors
+    /// and the texture coordinates of the fill vertices, and
+    /// flags the outline for update.
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateInside();
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' color
     ///
@@ -288,32 +320,45 @@ private:
     ////////////////////////////////////////////////////////////
     void updateTexCoords();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Make sure the outline and the bounds are updated
+    ///
+    /// The outline vertices are only built when the outline is
+    /// visible (its thickness is not 0), and only when they are
+    /// needed, i.e. when the shape is drawn or its bounds are requested.
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureOutlineUpdate() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the outline vertices' position
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutline();
+    void updateOutline() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the outline vertices' color
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutlineColors();
+    void updateOutlineColors() const;
 
 private:
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    const Texture* m_texture;          ///< Texture of the shape
-    IntRect        m_textureRect;      ///< Rectangle defining the area of the source texture to display
-    Color          m_fillColor;        ///< Fill color
-    Color          m_outlineColor;     ///< Outline color
-    float          m_outlineThickness; ///< Thickness of the shape's outline
-    VertexArray    m_vertices;         ///< Vertex array containing the fill geometry
-    VertexArray    m_outlineVertices;  ///< Vertex array containing the outline geometry
-    FloatRect      m_insideBounds;     ///< Bounding rectangle of the inside (fill)
-    FloatRect      m_bounds;           ///< Bounding rectangle of the whole shape (outline + fill)
+    const Texture*      m_texture;           ///< Texture of the shape
+    IntRect             m_textureRect;       ///< Rectangle defining the area of the source texture to display
+    Color               m_fillColor;         ///< Fill color
+    Color               m_outlineColor;      ///< Outline color
+    float               m_outlineThickness;  ///< Thickness of the shape's outline
+    VertexArray         m_vertices;          ///< Vertex array containing the fill geometry
+    mutable VertexArray m_outlineVertices;   ///< Vertex array containing the outline geometry
+    FloatRect           m_insideBounds;      ///< Bounding rectangle of the inside (fill), before scaling
+    mutable FloatRect   m_bounds;            ///< Bounding rectangle of the whole shape (outline + fill)
+    const Vector2f*     m_unitPoints;        ///< Shared unit geometry of the fill, if any
+    Vector2f            m_geometryScale;     ///< Scale applied to the fill vertices at rendering time
+    mutable bool        m_outlineNeedUpdate; ///< Do the outline and the bounds need to be recomputed?
 };
 
 } // namespace sf
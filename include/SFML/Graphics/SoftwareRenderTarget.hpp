@@ -0,0 +1,275 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SOFTWARERENDERTARGET_HPP
+#define SFML_SOFTWARERENDERTARGET_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <map>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Target for 2D rendering into an image, on the CPU
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SoftwareRenderTarget : public RenderTarget
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Constructs an empty, invalid target. You must call
+    /// create to have a valid target.
+    ///
+    /// \see create
+    ///
+    ////////////////////////////////////////////////////////////
+    SoftwareRenderTarget();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the target
+    ///
+    /// The contents of the target are initially transparent black.
+    ///
+    /// \param width  Width of the target
+    /// \param height Height of the target
+    ///
+    /// \return True if creation has been successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool create(unsigned int width, unsigned int height);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the target
+    ///
+    /// \return Size in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of threads used to rasterize
+    ///
+    /// The target is split into horizontal bands, each one
+    /// rendered by a different thread. The default count is 1:
+    /// everything runs in the thread which calls display.
+    ///
+    /// \param count Number of threads, including the calling thread
+    ///
+    /// \see getThreadCount
+    ///
+    ////////////////////////////////////////////////////////////
+    void setThreadCount(unsigned int count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads used to rasterize
+    ///
+    /// \return Number of threads, including the calling thread
+    ///
+    /// \see setThreadCount
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getThreadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the entire target with a single color
+    ///
+    /// The draws which were not displayed yet are discarded.
+    ///
+    /// \param color Fill color to use to clear the target
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void clear(const Color& color = Color(0, 0, 0, 255));
+
+    using RenderTarget::draw;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices
+    ///
+    /// The vertices are transformed to pixel coordinates right
+    /// away, but they are rasterized by display.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(const Vertex* vertices, std::size_t vertexCount,
+                      PrimitiveType type, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize what has been drawn and update the image
+    ///
+    /// This function must be called once all the draws of the
+    /// frame are done, before using getImage.
+    ///
+    ////////////////////////////////////////////////////////////
+    void display();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the rendered image
+    ///
+    /// The image contains what was rendered at the last call to display.
+    ///
+    /// \return Const reference to the image
+    ///
+    ////////////////////////////////////////////////////////////
+    const Image& getImage() const;
+
+private:
+
+    struct RasterTask;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate the target for rendering
+    ///
+    /// The target has no OpenGL context: this function always
+    /// fails, so that the functions of sf::RenderTarget which
+    /// use OpenGL directly (pushGLStates, ...) do nothing.
+    ///
+    /// \param active True to activate, false to deactivate
+    ///
+    /// \return Always false
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool activate(bool active);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize the pending draws in a band of rows
+    ///
+    /// Bands are independent, so that they can be rendered in
+    /// parallel.
+    ///
+    /// \param top    First row of the band
+    /// \param bottom Row after the last row of the band
+    ///
+    ////////////////////////////////////////////////////////////
+    void rasterize(unsigned int top, unsigned int bottom);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy of the pixels of a texture, for sampling
+    ///
+    ////////////////////////////////////////////////////////////
+    struct TextureCopy
+    {
+        Uint64 cacheId; ///< Cache identifier of the texture when it was copied
+        Image  image;   ///< Pixels of the texture
+        bool   used;    ///< Was the texture used since the last display?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recorded draw
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Command
+    {
+        const TextureCopy* texture;    ///< Texture to sample, or NULL
+        bool               isSmooth;   ///< Is the texture sampled with bilinear filtering?
+        bool               isRepeated; ///< Is the texture repeated?
+        BlendMode          blendMode;  ///< Blend mode of the draw
+        PrimitiveType      type;       ///< Type of primitives (never a strip or a fan)
+        IntRect            clip;       ///< Viewport of the draw, in pixels
+        std::size_t        first;      ///< Index of the first vertex in the vertex storage
+        std::size_t        count;      ///< Number of vertices
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    typedef std::map<const Texture*, TextureCopy> TextureTable;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u             m_size;        ///< Size of the target
+    unsigned int         m_threadCount; ///< Number of threads used by display
+    std::vector<Uint8>   m_pixels;      ///< Pixels being rendered (RGBA)
+    std::vector<Command> m_commands;    ///< Draws waiting to be rasterized
+    std::vector<Vertex>  m_vertices;    ///< Vertices of the pending draws, in pixel coordinates
+    TextureTable         m_textures;    ///< Copies of the textures used by the pending draws
+    Image                m_image;       ///< Image updated by display
+};
+
+} // namespace sf
+
+
+#endif // SFML_SOFTWARERENDERTARGET_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoftwareRenderTarget
+/// \ingroup graphics
+///
+/// sf::SoftwareRenderTarget renders the same entities as
+/// the other render targets (sprites, shapes, text, vertex
+/// arrays...), but rasterizes them on the CPU into an
+/// sf::Image. It is meant for machines without a GPU, such
+/// as servers which generate previews, and for tests which
+/// compare rendered images.
+///
+/// Triangles, lines and points are rasterized with the
+/// same conventions as OpenGL (pixel centers, top-left fill
+/// rule), colors are modulated by the texture, and the blend
+/// mode is applied exactly like the graphics card would; the
+/// result therefore closely matches the OpenGL rendering.
+/// Shaders are not supported: they are ignored.
+///
+/// Textures are read from the graphics memory with
+/// Texture::copyToImage the first time they are drawn (and
+/// again only when they change), so a textured draw needs
+/// an OpenGL context, possibly a software one; untextured
+/// geometry doesn't need OpenGL at all.
+///
+/// Draws are only recorded by the draw functions; they are
+/// rasterized by display, which splits the target into bands
+/// which can be rendered by several threads (see setThreadCount).
+///
+/// Usage example:
+/// \code
+/// sf::SoftwareRenderTarget target;
+/// target.create(256, 256);
+/// target.setThreadCount(4);
+///
+/// target.clear(sf::Color::White);
+/// target.draw(shape);
+/// target.draw(text);
+/// target.display();
+///
+/// target.getImage().saveToFile("thumbnail.png");
+/// \endcode
+///
+/// \see sf::RenderTarget, sf::RenderTexture, sf::Image
+///
+////////////////////////////////////////////////////////////
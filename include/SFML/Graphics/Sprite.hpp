@@ -38,6 +38,7 @@
 namespace sf
 {
 class Texture;
+class TextureArray;
 
 ////////////////////////////////////////////////////////////
 /// \brief Drawable representation of a texture, with its
@@ -98,6 +99,23 @@ public:
     ////////////////////////////////////////////////////////////
     void setTexture(const Texture& texture, bool resetRect = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the source texture of the sprite to a layer of a texture array
+    ///
+    /// The sprite displays the texture of the array, with
+    /// its texture rect set to the area of \a layer. Like
+    /// a texture, the array must exist as long as the sprite
+    /// uses it. Sprites that display any layer of the same
+    /// array can be drawn in a single batch.
+    ///
+    /// \param textures Texture array
+    /// \param layer    Index of the layer to display
+    ///
+    /// \see getTexture, setTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const TextureArray& textures, unsigned int layer);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the sub-rectangle of the texture that the sprite will display
     ///
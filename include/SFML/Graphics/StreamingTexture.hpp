@@ -0,0 +1,293 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_STREAMINGTEXTURE_HPP
+#define SFML_STREAMINGTEXTURE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Window/GlResource.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class Image;
+
+////////////////////////////////////////////////////////////
+/// \brief Texture continuously updated with frames produced
+///        by another thread
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API StreamingTexture : GlResource, NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty streaming texture.
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingTexture();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~StreamingTexture();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the streaming texture
+    ///
+    /// All the frames must have this size. The texture is
+    /// initially transparent black. This function must not
+    /// be called while another thread submits frames.
+    ///
+    /// \param width  Width of the frames
+    /// \param height Height of the frames
+    ///
+    /// \return True if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool create(unsigned int width, unsigned int height);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the frames
+    ///
+    /// \return Size in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a frame buffer to write the next frame into
+    ///
+    /// This function is meant to be called by the producer
+    /// thread (i.e. a video decoder): it can decode directly
+    /// into the returned buffer, then call endFrame to publish
+    /// it. The buffer holds getSize().x * getSize().y RGBA
+    /// pixels, it's never read by the render thread before
+    /// endFrame is called.
+    ///
+    /// \return Pointer to the pixels of the next frame
+    ///
+    /// \see endFrame, submitFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint8* beginFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Publish the frame written since beginFrame
+    ///
+    /// The frame becomes the most recent complete one; if the
+    /// previous frame was not presented yet, it is dropped.
+    /// This function never waits for the render thread.
+    ///
+    /// \see beginFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    void endFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy and publish a new frame
+    ///
+    /// This is a shortcut for beginFrame, copying the pixels
+    /// and endFrame. The \a pixels array must contain
+    /// getSize().x * getSize().y RGBA pixels.
+    ///
+    /// \param pixels Array of pixels of the frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void submitFrame(const Uint8* pixels);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy and publish a new frame from an image
+    ///
+    /// The image must have the size of the streaming texture.
+    ///
+    /// \param image Image which contains the frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void submitFrame(const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the most recent complete frame
+    ///
+    /// This function must be called by the thread which renders
+    /// the texture, typically once per frame before drawing. If
+    /// a new frame was published since the last call, it is
+    /// uploaded to a texture which is not the one currently
+    /// displayed, which then becomes the one returned by
+    /// getTexture. Otherwise nothing happens, and the previous
+    /// frame stays displayed: this function never waits
+    /// for the producer.
+    ///
+    /// \return True if a new frame is presented
+    ///
+    ////////////////////////////////////////////////////////////
+    bool present();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture which holds the presented frame
+    ///
+    /// The returned texture changes every time that present
+    /// uploads a new frame, so it should be queried again
+    /// after each call to present.
+    ///
+    /// \return Texture of the presented frame
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    /// \see isSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter is enabled or not
+    ///
+    /// \return True if smoothing is enabled, false if it is disabled
+    ///
+    /// \see setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isSmooth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames dropped so far
+    ///
+    /// A frame is dropped when the producer publishes a new
+    /// one before the previous one was presented.
+    ///
+    /// \return Number of frames that were never presented
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getDroppedFrameCount() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the pixel buffer objects
+    ///
+    ////////////////////////////////////////////////////////////
+    void destroyPixelBuffers();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload a frame into one of the textures
+    ///
+    /// \param index  Index of the texture to update
+    /// \param pixels Pixels of the frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void upload(unsigned int index, const Uint8* pixels);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Texture            m_textures[3];     ///< Textures, which are updated and presented in turn
+    unsigned int       m_pixelBuffers[3]; ///< Pixel buffer objects used to upload into each texture (0 if not supported)
+    std::vector<Uint8> m_frames[3];       ///< Frames in system memory: being written, ready and being uploaded
+    Vector2u           m_size;            ///< Size of the frames
+    unsigned int       m_writeFrame;      ///< Index of the frame owned by the producer
+    unsigned int       m_readyFrame;      ///< Index of the most recent complete frame
+    unsigned int       m_readFrame;       ///< Index of the frame owned by the render thread
+    bool               m_hasNewFrame;     ///< Was the ready frame published since the last presentation?
+    unsigned int       m_currentTexture;  ///< Index of the texture which holds the presented frame
+    unsigned int       m_droppedCount;    ///< Number of frames that were never presented
+    mutable Mutex      m_mutex;           ///< Protects the frame indices
+};
+
+} // namespace sf
+
+
+#endif // SFML_STREAMINGTEXTURE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::StreamingTexture
+/// \ingroup graphics
+///
+/// Updating a regular sf::Texture with frames that another
+/// thread produces (video playback, camera capture, remote
+/// desktop...) requires to synchronize both threads, and the
+/// upload stalls the rendering whenever the driver still uses
+/// the texture for previous draw calls.
+///
+/// sf::StreamingTexture keeps three frames in system memory:
+/// the one being written by the producer, the most recent
+/// complete one, and the one being uploaded by the render
+/// thread. Publishing and presenting a frame only exchange
+/// indices, so none of the threads ever waits for the other
+/// one to finish a copy or a decoding, and the render thread
+/// never sees a partially written frame.
+///
+/// On the GPU side, three textures are updated in turn, so that
+/// a new frame never overwrites the texture that pending draw
+/// calls still read. When pixel buffer objects are supported,
+/// the pixels are uploaded through them and the transfer
+/// happens asynchronously.
+///
+/// Usage example:
+/// \code
+/// // Decoder thread
+/// void decode(sf::StreamingTexture& video, Decoder& decoder)
+/// {
+///     while (decoder.hasFrames())
+///     {
+///         decoder.decodeNextFrame(video.beginFrame());
+///         video.endFrame();
+///     }
+/// }
+///
+/// // Main thread
+/// sf::StreamingTexture video;
+/// video.create(1280, 720);
+/// sf::Thread thread(&decode, ...);
+/// thread.launch();
+///
+/// while (window.isOpen())
+/// {
+///     ...
+///     video.present();
+///     window.draw(sf::Sprite(video.getTexture()));
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::Texture
+///
+////////////////////////////////////////////////////////////
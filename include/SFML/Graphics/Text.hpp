@@ -62,6 +62,17 @@ public:
         StrikeThrough = 1 << 3  ///< Strike through characters
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enumeration of the horizontal alignments of the lines
+    ///
+    ////////////////////////////////////////////////////////////
+    enum Alignment
+    {
+        Left,   ///< Lines are aligned on the left edge
+        Center, ///< Lines are centered
+        Right   ///< Lines are aligned on the right edge
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -170,6 +181,37 @@ public:
     ////////////////////////////////////////////////////////////
     void setColor(const Color& color);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum width of the lines
+    ///
+    /// When a line becomes wider than \a maxWidth, it is broken
+    /// after its last whitespace; if the line contains no
+    /// whitespace, it is broken between two characters.
+    /// Trailing whitespace is allowed to overflow.
+    /// A value of 0 disables automatic line breaking, which
+    /// is the default.
+    ///
+    /// \param maxWidth New maximum width, in local coordinates
+    ///
+    /// \see getMaxWidth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxWidth(float maxWidth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the horizontal alignment of the lines
+    ///
+    /// Lines are aligned within the maximum width if one is
+    /// set (see setMaxWidth), or within the widest line otherwise.
+    /// The default alignment is sf::Text::Left.
+    ///
+    /// \param alignment New alignment
+    ///
+    /// \see getAlignment
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAlignment(Alignment alignment);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the text's string
     ///
@@ -233,6 +275,26 @@ public:
     ////////////////////////////////////////////////////////////
     const Color& getColor() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum width of the lines
+    ///
+    /// \return Maximum width, or 0 if line breaking is disabled
+    ///
+    /// \see setMaxWidth
+    ///
+    ////////////////////////////////////////////////////////////
+    float getMaxWidth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the horizontal alignment of the lines
+    ///
+    /// \return Current alignment
+    ///
+    /// \see setAlignment
+    ///
+    ////////////////////////////////////////////////////////////
+    Alignment getAlignment() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the position of the \a index-th character
     ///
@@ -243,13 +305,69 @@ public:
     /// If \a index is out of range, the position of the end of
     /// the string is returned.
     ///
+    /// The positions of all the characters are computed once
+    /// by the layout stage and then cached, so this function
+    /// runs in constant time as long as the text is not modified.
+    ///
     /// \param index Index of the character
     ///
     /// \return Position of the character
     ///
+    /// \see findCharacterIndex
+    ///
     ////////////////////////////////////////////////////////////
     Vector2f findCharacterPos(std::size_t index) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the character located under a point
+    ///
+    /// This function is the inverse of findCharacterPos: it
+    /// returns the index of the character whose cell contains
+    /// \a point, which is in global coordinates. Points located
+    /// above the first line or below the last line are clamped
+    /// to these lines; points located after the end of the last
+    /// line return the size of the string.
+    /// The search is logarithmic in the size of the string.
+    ///
+    /// \param point Point to test, in global coordinates
+    ///
+    /// \return Index of the character under the point
+    ///
+    /// \see findCharacterPos
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t findCharacterIndex(const Vector2f& point) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of lines of the text
+    ///
+    /// This includes the lines created by explicit line feeds
+    /// as well as the ones created by automatic line breaking.
+    ///
+    /// \return Number of lines, or 0 if the text has no font
+    ///
+    /// \see getLineBounds
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getLineCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounding rectangle of a line
+    ///
+    /// The returned rectangle is in local coordinates. Its
+    /// height is the line spacing of the font, and its width
+    /// excludes the trailing whitespace of the line.
+    /// If \a line is out of range, an empty rectangle is returned.
+    ///
+    /// \param line Index of the line
+    ///
+    /// \return Bounding rectangle of the line
+    ///
+    /// \see getLineCount
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getLineBounds(std::size_t line) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the local bounding rectangle of the entity
     ///
@@ -298,17 +416,47 @@ private:
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the position of every character
+    ///
+    /// This function performs line breaking and alignment in
+    /// a single pass over the string, and fills the line and
+    /// character position caches.
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateLayout() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Metrics of a laid out line
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Line
+    {
+        std::size_t begin;       ///< Index of the first character of the line
+        std::size_t end;         ///< Index one past the last character of the line
+        float       left;        ///< Horizontal offset of the line, given by the alignment
+        float       top;         ///< Vertical position of the top of the line
+        float       width;       ///< Width of the line, trailing whitespace excluded
+        bool        rightToLeft; ///< Is the line written from right to left?
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    String              m_string;             ///< String to display
-    const Font*         m_font;               ///< Font used to display the string
-    unsigned int        m_characterSize;      ///< Base size of characters, in pixels
-    Uint32              m_style;              ///< Text style (see Style enum)
-    Color               m_color;              ///< Text color
-    mutable VertexArray m_vertices;           ///< Vertex array containing the text's geometry
-    mutable FloatRect   m_bounds;             ///< Bounding rectangle of the text (in local coordinates)
-    mutable bool        m_geometryNeedUpdate; ///< Does the geometry need to be recomputed?
+    String                                 m_string;             ///< String to display
+    const Font*                            m_font;               ///< Font used to display the string
+    unsigned int                           m_characterSize;      ///< Base size of characters, in pixels
+    Uint32                                 m_style;              ///< Text style (see Style enum)
+    Color                                  m_color;              ///< Text color
+    float                                  m_maxWidth;           ///< Maximum width of the lines (0 to disable line breaking)
+    Alignment                              m_alignment;          ///< Horizontal alignment of the lines
+    mutable VertexArray                    m_vertices;           ///< Vertex array containing the text's geometry
+    mutable FloatRect                      m_bounds;             ///< Bounding rectangle of the text (in local coordinates)
+    mutable std::vector<Vector2f>          m_characterPositions; ///< Cached position of each character, plus the end of the string (local coordinates)
+    mutable std::vector<Line>              m_lines;              ///< Cached metrics of each line
+    mutable std::vector<Font::ShapedGlyph> m_glyphs;             ///< Shaped glyphs of the string, sorted by character (empty if the string is not shaped)
+    mutable std::vector<float>             m_advances;           ///< Advance of each character given by the shaper (empty if the string is not shaped)
+    mutable bool                           m_geometryNeedUpdate; ///< Does the geometry need to be recomputed?
 };
 
 } // namespace sf
@@ -333,6 +481,24 @@ private:
 /// graphical size of the text, or to get the global position
 /// of a given character.
 ///
+/// Paragraphs can be laid out directly by sf::Text: lines
+/// longer than a maximum width are broken automatically
+/// (see setMaxWidth), and lines can be aligned on the left,
+/// on the right or centered (see setAlignment). The position of
+/// every character is computed in a single pass and cached, so
+/// that findCharacterPos, findCharacterIndex and getLineBounds
+/// are cheap enough to be used for hit-testing and text editing.
+///
+/// When SFML is built with HarfBuzz support, each paragraph of
+/// the string is shaped before being laid out, which gives proper
+/// ligatures, contextual forms and mark positioning for complex
+/// scripts such as Arabic or Devanagari. Paragraphs written from
+/// right to left are laid out from right to left. Shaping results
+/// are cached by the font, so a string is only shaped again when
+/// it changes. Note that no bidirectional reordering is performed:
+/// each paragraph is shaped as a single run, in the direction
+/// detected from its content.
+///
 /// sf::Text works in combination with the sf::Font class, which
 /// loads and provides the glyphs (visual characters) of a given font.
 ///
@@ -363,6 +529,10 @@ private:
 /// text.setStyle(sf::Text::Bold);
 /// text.setColor(sf::Color::Red);
 ///
+/// // Wrap it within 200 pixels, and center the lines
+/// text.setMaxWidth(200);
+/// text.setAlignment(sf::Text::Center);
+///
 /// // Draw it
 /// window.draw(text);
 /// \endcode
@@ -40,6 +40,11 @@ class RenderTarget;
 class RenderTexture;
 class InputStream;
 
+namespace priv
+{
+    class ResourceAccess;
+}
+
 ////////////////////////////////////////////////////////////
 /// \brief Image living on the graphics card that can be used for drawing
 ///
@@ -484,6 +489,7 @@ private:
 
     friend class RenderTexture;
     friend class RenderTarget;
+    friend class priv::ResourceAccess;
 
     ////////////////////////////////////////////////////////////
     /// \brief Get a valid image size according to hardware support
@@ -500,16 +506,80 @@ private:
     ////////////////////////////////////////////////////////////
     static unsigned int getValidSize(unsigned int size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Flag the contents of the texture as modified
+    ///
+    /// This function gives a new cache identifier to the texture,
+    /// for the modifications that don't go through its own
+    /// functions (i.e. rendering into a sf::RenderTexture).
+    ///
+    ////////////////////////////////////////////////////////////
+    void markAsModified();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind a texture, without touching the texture matrix
+    ///
+    /// Evicted textures are restored first. If \a texture is
+    /// NULL or empty, no texture is bound.
+    ///
+    /// \param texture Pointer to the texture to bind, can be null
+    ///
+    /// \return True if a texture was bound
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool bindTexture(const Texture* texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a matrix into the OpenGL texture matrix
+    ///
+    /// \param matrix 4x4 matrix to load, or NULL for identity
+    ///
+    ////////////////////////////////////////////////////////////
+    static void loadMatrix(const float* matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the orientation of the pixels
+    ///
+    /// The texture matrix used with pixel coordinates is
+    /// recomputed, so that binding the texture doesn't have to
+    /// do it. This function must be used to change m_pixelsFlipped,
+    /// and be called whenever the size of the texture changes.
+    ///
+    /// \param flipped True if the rows are stored bottom to top
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPixelsFlipped(bool flipped) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the video memory of the texture
+    ///
+    /// The pixels are kept in system memory, until the texture
+    /// is used again and restored. This function is called by
+    /// sf::TextureManager to respect its budget.
+    ///
+    ////////////////////////////////////////////////////////////
+    void evict() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the pixels of an evicted texture back to the video memory
+    ///
+    ////////////////////////////////////////////////////////////
+    void restore() const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Vector2u     m_size;          ///< Public texture size
-    Vector2u     m_actualSize;    ///< Actual texture size (can be greater than public size because of padding)
-    unsigned int m_texture;       ///< Internal texture identifier
-    bool         m_isSmooth;      ///< Status of the smooth filter
-    bool         m_isRepeated;    ///< Is the texture in repeat mode?
-    mutable bool m_pixelsFlipped; ///< To work around the inconsistency in Y orientation
-    Uint64       m_cacheId;       ///< Unique number that identifies the texture to the render target's cache
+    Vector2u             m_size;             ///< Public texture size
+    Vector2u             m_actualSize;       ///< Actual texture size (can be greater than public size because of padding)
+    mutable unsigned int m_texture;          ///< Internal texture identifier
+    bool                 m_isSmooth;         ///< Status of the smooth filter
+    bool                 m_isRepeated;       ///< Is the texture in repeat mode?
+    mutable bool         m_pixelsFlipped;    ///< To work around the inconsistency in Y orientation
+    mutable Uint64       m_cacheId;          ///< Unique number that identifies the texture to the render target's cache
+    mutable bool         m_isEvicted;        ///< Is the texture evicted from the video memory?
+    mutable Image        m_evictedImage;     ///< Pixels of the texture while it is evicted
+    bool                 m_isEvictable;      ///< Can the texture be evicted? (not if it's attached to a render texture)
+    mutable float        m_pixelsMatrix[16]; ///< Texture matrix that maps pixel coordinates to normalized ones
 };
 
 } // namespace sf
@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TEXTUREARRAY_HPP
+#define SFML_TEXTUREARRAY_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+
+namespace sf
+{
+class Image;
+
+////////////////////////////////////////////////////////////
+/// \brief Set of images of the same size, stored in a single texture
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureArray : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty array.
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureArray();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the array
+    ///
+    /// The contents of the layers are undefined after
+    /// this call; use update to fill them.
+    /// If this function fails, the array is left unchanged.
+    ///
+    /// \param width      Width of each layer
+    /// \param height     Height of each layer
+    /// \param layerCount Number of layers
+    ///
+    /// \return True if creation was successful
+    ///
+    /// \see loadFromImage, update
+    ///
+    ////////////////////////////////////////////////////////////
+    bool create(unsigned int width, unsigned int height, unsigned int layerCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the array from a sprite sheet
+    ///
+    /// The sheet is split into cells of \a layerSize, which
+    /// become the layers of the array, row by row. Incomplete
+    /// cells on the right and bottom edges are ignored.
+    /// If this function fails, the array is left unchanged.
+    ///
+    /// \param image     Sprite sheet to split
+    /// \param layerSize Size of each layer
+    ///
+    /// \return True if loading was successful
+    ///
+    /// \see create
+    ///
+    ////////////////////////////////////////////////////////////
+    bool loadFromImage(const Image& image, const Vector2u& layerSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a whole layer from an array of pixels
+    ///
+    /// The \a pixel array is assumed to contain 32-bits RGBA
+    /// pixels, and to have the size of the layers.
+    ///
+    /// \param layer  Index of the layer to update
+    /// \param pixels Array of pixels to copy to the layer
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(unsigned int layer, const Uint8* pixels);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a whole layer from an image
+    ///
+    /// The image must have the size of the layers.
+    ///
+    /// \param layer Index of the layer to update
+    /// \param image Image to copy to the layer
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(unsigned int layer, const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the layers
+    ///
+    /// \return Size of each layer, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getLayerSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of layers
+    ///
+    /// \return Number of layers
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getLayerCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the area of a layer in the texture
+    ///
+    /// This is the rectangle to give to Sprite::setTextureRect
+    /// to display the layer.
+    ///
+    /// \param layer Index of the layer
+    ///
+    /// \return Area of the layer, in texture pixels
+    ///
+    /// \see getTexCoords
+    ///
+    ////////////////////////////////////////////////////////////
+    IntRect getLayerRect(unsigned int layer) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert coordinates in a layer to texture coordinates
+    ///
+    /// This is the function to use to fill the texture
+    /// coordinates of vertices, for example in a VertexArray.
+    ///
+    /// \param layer  Index of the layer
+    /// \param coords Coordinates in the layer, in pixels
+    ///
+    /// \return Texture coordinates, in texture pixels
+    ///
+    /// \see getLayerRect
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2f getTexCoords(unsigned int layer, const Vector2f& coords) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter
+    ///
+    /// Smoothing never mixes the pixels of different layers.
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    /// \see isSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter is enabled or not
+    ///
+    /// \return True if smoothing is enabled, false if it is disabled
+    ///
+    /// \see setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isSmooth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture which stores all the layers
+    ///
+    /// \return Texture of the array
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& getTexture() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Texture      m_texture;     ///< Texture storing the layers, in a grid
+    Vector2u     m_layerSize;   ///< Size of each layer
+    unsigned int m_layerCount;  ///< Number of layers
+    unsigned int m_columnCount; ///< Number of layers in each row of the grid
+};
+
+} // namespace sf
+
+
+#endif // SFML_TEXTUREARRAY_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureArray
+/// \ingroup graphics
+///
+/// Animations, tile sets and other collections of images of
+/// the same size are often loaded as separate textures, which
+/// forces a texture change (and thus a separate draw call)
+/// between every sprite that uses a different image.
+///
+/// sf::TextureArray stores all the images (the layers) in a
+/// single sf::Texture, so that entities that use any of them
+/// share the same render states: sf::RenderQueue and
+/// sf::CommandBuffer can merge them into a single batch.
+///
+/// The layers are laid out in a grid. Each layer is surrounded
+/// by a copy of its edge pixels, so that smoothing doesn't
+/// bleed between neighbour layers. Like any texture, the array
+/// is limited by Texture::getMaximumSize, which bounds the
+/// number of layers it can hold.
+///
+/// The address of a layer in the texture is given by getLayerRect;
+/// sf::Sprite can also directly display a layer.
+///
+/// Usage example:
+/// \code
+/// sf::Image sheet;
+/// if (!sheet.loadFromFile("walk.png"))
+///     return -1;
+///
+/// // 200 frames of 64x64 pixels
+/// sf::TextureArray frames;
+/// if (!frames.loadFromImage(sheet, sf::Vector2u(64, 64)))
+///     return -1;
+///
+/// // All the characters use the same texture, whatever their frame
+/// for (std::size_t i = 0; i < characters.size(); ++i)
+///     characters[i].sprite.setTexture(frames, characters[i].frame);
+///
+/// // Custom geometry can address a layer too
+/// vertices[0].texCoords = frames.getTexCoords(12, sf::Vector2f(0, 0));
+/// \endcode
+///
+/// \see sf::Texture, sf::Sprite
+///
+////////////////////////////////////////////////////////////
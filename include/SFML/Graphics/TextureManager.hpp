@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TEXTUREMANAGER_HPP
+#define SFML_TEXTUREMANAGER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Config.hpp>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Keeps the video memory used by textures within a budget
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureManager
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Texture memory usage
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        Uint64       residentMemory; ///< Video memory allocated by the textures, in bytes
+        Uint64       evictedMemory;  ///< Memory of the evicted textures, kept in system memory, in bytes
+        unsigned int textureCount;   ///< Number of textures which have pixels (resident or evicted)
+        unsigned int evictedCount;   ///< Number of textures currently evicted
+        unsigned int evictions;      ///< Total number of evictions
+        unsigned int restorations;   ///< Total number of evicted textures uploaded back
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the video memory budget of the textures
+    ///
+    /// When the textures allocate more video memory than the
+    /// budget, the least recently used ones are evicted: their
+    /// pixels are copied to system memory, and their video memory
+    /// is released. An evicted texture is uploaded back the next
+    /// time it is used.
+    ///
+    /// A budget of 0 disables eviction, which is the default.
+    ///
+    /// \param bytes Maximum amount of video memory, in bytes
+    ///
+    /// \see getBudget
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setBudget(Uint64 bytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the video memory budget of the textures
+    ///
+    /// \return Maximum amount of video memory, in bytes (0 if unlimited)
+    ///
+    /// \see setBudget
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getBudget();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current memory usage of the textures
+    ///
+    /// \return Memory usage statistics
+    ///
+    ////////////////////////////////////////////////////////////
+    static Statistics getStatistics();
+
+private:
+
+    friend class Texture;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Account for the video memory of a texture
+    ///
+    /// This function is called every time a texture (re)allocates
+    /// its video memory, including when it is restored.
+    ///
+    /// \param texture   Texture which allocated video memory
+    /// \param memory    Size of the allocated video memory, in bytes
+    /// \param evictable Can the texture be evicted?
+    ///
+    ////////////////////////////////////////////////////////////
+    static void add(const Texture& texture, Uint64 memory, bool evictable);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop tracking a texture
+    ///
+    /// \param texture Texture to forget
+    ///
+    ////////////////////////////////////////////////////////////
+    static void remove(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark a texture as the most recently used
+    ///
+    /// This function is called every time a texture is bound,
+    /// it does nothing (and doesn't lock) when no budget is set.
+    ///
+    /// \param texture Texture which is being bound
+    ///
+    ////////////////////////////////////////////////////////////
+    static void touch(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Exchange the tracking information of two textures
+    ///
+    /// \param left  First texture
+    /// \param right Second texture
+    ///
+    ////////////////////////////////////////////////////////////
+    static void swap(const Texture& left, const Texture& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Evict textures until the budget is respected
+    ///
+    ////////////////////////////////////////////////////////////
+    static void enforceBudget();
+};
+
+} // namespace sf
+
+
+#endif // SFML_TEXTUREMANAGER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureManager
+/// \ingroup graphics
+///
+/// sf::TextureManager tracks the video memory allocated by
+/// all the sf::Texture instances, and can enforce a budget:
+/// when it is exceeded, the least recently bound textures are
+/// evicted to system memory, and transparently uploaded back
+/// when they are drawn again. This lets applications which
+/// load many more textures than the graphics card can hold
+/// degrade gracefully on low-end machines, instead of failing.
+///
+/// The textures of render textures are never evicted, nor
+/// the few textures bound most recently (a shader may use
+/// several of them at once). If the remaining textures don't
+/// fit in the budget, it is exceeded.
+///
+/// Restoring an evicted texture has the cost of a texture
+/// upload; choose a budget that holds at least the textures
+/// drawn in a typical frame.
+///
+/// Because the video memory is global, sf::TextureManager only
+/// contains static functions and doesn't have to be instantiated.
+///
+/// Usage example:
+/// \code
+/// // Use at most 256 MB of video memory for textures
+/// sf::TextureManager::setBudget(256 * 1024 * 1024);
+///
+/// ...
+///
+/// sf::TextureManager::Statistics statistics = sf::TextureManager::getStatistics();
+/// std::cout << statistics.residentMemory / 1024 << " KB in video memory, "
+///           << statistics.evictedCount << " textures evicted" << std::endl;
+/// \endcode
+///
+/// \see sf::Texture
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,271 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TILEMAP_HPP
+#define SFML_TILEMAP_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Grid of tiles taken from a tileset texture
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TileMap : public Drawable, public Transformable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty tile map.
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the tile map
+    ///
+    /// All the tiles are initially empty. The map is split into
+    /// square chunks of \a chunkSize x \a chunkSize tiles; the
+    /// geometry of a chunk is built once, and only rebuilt when
+    /// one of its tiles changes. Large chunks mean fewer draw
+    /// calls, small chunks mean cheaper rebuilds and more precise
+    /// culling.
+    ///
+    /// \param size      Size of the map, in tiles
+    /// \param tileSize  Size of a tile, in pixels (both in the texture and in the map)
+    /// \param chunkSize Size of the side of a chunk, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    void create(const Vector2u& size, const Vector2u& tileSize, unsigned int chunkSize = 32);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tileset texture
+    ///
+    /// The tileset is a texture which contains all the tiles,
+    /// packed in rows from left to right and top to bottom:
+    /// tile number N is the N-th tile in this order.
+    ///
+    /// The \a tileset argument refers to a texture that must
+    /// exist as long as the tile map uses it.
+    ///
+    /// \param tileset Tileset texture
+    ///
+    /// \see getTileset
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTileset(const Texture* tileset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tileset texture
+    ///
+    /// \return Pointer to the tileset, or NULL if there's none
+    ///
+    /// \see setTileset
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* getTileset() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a tile of the map
+    ///
+    /// Only the chunk which contains the tile is rebuilt, the
+    /// next time it is drawn.
+    /// This function does nothing if the coordinates are out of
+    /// the map.
+    ///
+    /// \param x    Column of the tile
+    /// \param y    Row of the tile
+    /// \param tile Index of the tile in the tileset, or -1 for an empty tile
+    ///
+    /// \see getTile
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTile(unsigned int x, unsigned int y, int tile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a tile of the map
+    ///
+    /// \param x Column of the tile
+    /// \param y Row of the tile
+    ///
+    /// \return Index of the tile in the tileset, or -1 if the tile is empty or out of the map
+    ///
+    /// \see setTile
+    ///
+    ////////////////////////////////////////////////////////////
+    int getTile(unsigned int x, unsigned int y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the map
+    ///
+    /// \return Size of the map, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2u& getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the tiles
+    ///
+    /// \return Size of a tile, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2u& getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the entity.
+    /// In other words, this function returns the bounds of the
+    /// entity in the entity's coordinate system.
+    ///
+    /// \return Local bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the entity.
+    /// In other words, this function returns the bounds of the
+    /// tile map in the global 2D world's coordinate system.
+    ///
+    /// \return Global bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getGlobalBounds() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the visible chunks to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rebuild the geometry of a chunk
+    ///
+    /// \param column Column of the chunk
+    /// \param row    Row of the chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateChunk(unsigned int column, unsigned int row) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Flag all the chunks for update
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidateChunks();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached geometry of a block of tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        std::vector<Vertex> vertices; ///< Triangles of the non-empty tiles of the chunk
+        bool                dirty;    ///< Does the geometry need to be rebuilt?
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Texture*             m_tileset;    ///< Texture containing the tiles
+    Vector2u                   m_size;       ///< Size of the map, in tiles
+    Vector2u                   m_tileSize;   ///< Size of a tile, in pixels
+    unsigned int               m_chunkSize;  ///< Size of the side of a chunk, in tiles
+    Vector2u                   m_chunkCount; ///< Number of chunks in each direction
+    std::vector<int>           m_tiles;      ///< Tile indices, row by row
+    mutable std::vector<Chunk> m_chunks;     ///< Chunks of the map, row by row
+};
+
+} // namespace sf
+
+
+#endif // SFML_TILEMAP_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TileMap
+/// \ingroup graphics
+///
+/// sf::TileMap is a drawable class for maps made of square
+/// tiles that all come from the same texture, the tileset.
+///
+/// The map is divided into chunks: blocks of tiles whose
+/// geometry is built once and kept in memory. Modifying a tile
+/// only flags its chunk, which is rebuilt the next time it is
+/// drawn, and drawing the map only draws the chunks which
+/// overlap the view of the render target. The cost of drawing
+/// a map therefore depends on what is visible, not on the
+/// size of the whole map.
+///
+/// sf::TileMap inherits sf::Transformable: it can be
+/// positioned, rotated and scaled like any other entity.
+///
+/// Usage example:
+/// \code
+/// sf::Texture tileset;
+/// tileset.loadFromFile("tileset.png");
+///
+/// // A 1000x1000 map of 32x32 tiles
+/// sf::TileMap map;
+/// map.create(sf::Vector2u(1000, 1000), sf::Vector2u(32, 32));
+/// map.setTileset(&tileset);
+/// for (unsigned int y = 0; y < 1000; ++y)
+///     for (unsigned int x = 0; x < 1000; ++x)
+///         map.setTile(x, y, level[y][x]);
+///
+/// // Only the visible part of the map is drawn
+/// window.setView(camera);
+/// window.draw(map);
+/// \endcode
+///
+/// \see sf::Texture, sf::VertexArray
+///
+////////////////////////////////////////////////////////////
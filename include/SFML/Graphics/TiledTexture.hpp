@@ -0,0 +1,248 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TILEDTEXTURE_HPP
+#define SFML_TILEDTEXTURE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <string>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Image of any size, split into textures which
+///        are uploaded on demand
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TiledTexture : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty tiled texture.
+    ///
+    ////////////////////////////////////////////////////////////
+    TiledTexture();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TiledTexture();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the tiled texture from a file on disk
+    ///
+    /// \param filename Path of the image file to load
+    /// \param tileSize Size of the side of a tile, in pixels (0 for the default size)
+    ///
+    /// \return True if loading was successful
+    ///
+    /// \see loadFromImage
+    ///
+    ////////////////////////////////////////////////////////////
+    bool loadFromFile(const std::string& filename, unsigned int tileSize = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the tiled texture from an image
+    ///
+    /// The image is copied and split into square tiles of
+    /// \a tileSize x \a tileSize pixels (smaller on the right
+    /// and bottom edges). No texture is created here: a tile
+    /// is uploaded the first time it is requested with getTile.
+    ///
+    /// The tile size is limited to what the graphics card
+    /// supports; the default size is 1024 pixels.
+    ///
+    /// \param image    Image to load
+    /// \param tileSize Size of the side of a tile, in pixels (0 for the default size)
+    ///
+    /// \return True if loading was successful
+    ///
+    /// \see loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    bool loadFromImage(const Image& image, unsigned int tileSize = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the whole image
+    ///
+    /// \return Size in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the side of a tile
+    ///
+    /// \return Tile size, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the number of tiles in each direction
+    ///
+    /// \return Number of columns and rows of tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getTileCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the area of the image covered by a tile
+    ///
+    /// \param x Column of the tile
+    /// \param y Row of the tile
+    ///
+    /// \return Area of the tile, in image pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    IntRect getTileRect(unsigned int x, unsigned int y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture of a tile, uploading it if needed
+    ///
+    /// The texture contains the area given by getTileRect,
+    /// surrounded by a border of 1 pixel taken from the
+    /// neighbour tiles, so that smoothing is seamless: the
+    /// pixels of the tile start at (1, 1) in the texture.
+    ///
+    /// \param x Column of the tile
+    /// \param y Row of the tile
+    ///
+    /// \return Texture of the tile, or NULL if the coordinates are out of range or the upload failed
+    ///
+    /// \see isTileLoaded, unloadTile
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* getTile(unsigned int x, unsigned int y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a tile is uploaded to the graphics card
+    ///
+    /// \param x Column of the tile
+    /// \param y Row of the tile
+    ///
+    /// \return True if the texture of the tile exists
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isTileLoaded(unsigned int x, unsigned int y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy the texture of a tile
+    ///
+    /// The tile will be uploaded again the next time it is
+    /// requested. This function does nothing if the tile is
+    /// not loaded.
+    ///
+    /// \param x Column of the tile
+    /// \param y Row of the tile
+    ///
+    ////////////////////////////////////////////////////////////
+    void unloadTile(unsigned int x, unsigned int y);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    /// \see isSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter is enabled or not
+    ///
+    /// \return True if smoothing is enabled, false if it is disabled
+    ///
+    /// \see setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isSmooth() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Image                         m_image;     ///< Pixels of the whole image, in system memory
+    unsigned int                  m_tileSize;  ///< Size of the side of a tile
+    Vector2u                      m_tileCount; ///< Number of columns and rows of tiles
+    mutable std::vector<Texture*> m_tiles;     ///< Textures of the tiles (NULL if not uploaded yet)
+    bool                          m_isSmooth;  ///< Status of the smooth filter
+};
+
+} // namespace sf
+
+
+#endif // SFML_TILEDTEXTURE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TiledTexture
+/// \ingroup graphics
+///
+/// A sf::Texture can't be larger than Texture::getMaximumSize,
+/// which is often 4096 or 8192 pixels, and a very large texture
+/// consumes a lot of video memory even if only a small part of
+/// it is ever visible.
+///
+/// sf::TiledTexture keeps the image in system memory and splits
+/// it into tiles that fit in a texture. The texture of a tile
+/// is only created the first time the tile is requested, which
+/// sf::BigSprite does when the tile becomes visible. Tiles
+/// which are not needed anymore can be released with
+/// unloadTile; sf::TextureManager can also evict them under
+/// its memory budget.
+///
+/// Usage example:
+/// \code
+/// // A 16384x16384 map
+/// sf::TiledTexture map;
+/// if (!map.loadFromFile("world.png"))
+///     return -1;
+///
+/// sf::BigSprite sprite(map);
+///
+/// // Only the tiles which intersect the view are uploaded and drawn
+/// window.draw(sprite);
+/// \endcode
+///
+/// \see sf::BigSprite, sf::Texture
+///
+////////////////////////////////////////////////////////////
@@ -31,10 +31,13 @@
 #include <SFML/Graphics/Export.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <cstddef>
 
 
 namespace sf
 {
+class Vertex;
+
 ////////////////////////////////////////////////////////////
 /// \brief Define a 3x3 transform matrix
 ///
@@ -118,6 +121,40 @@ public:
     ////////////////////////////////////////////////////////////
     Vector2f transformPoint(const Vector2f& point) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform an array of 2D points
+    ///
+    /// This function gives the same result as calling transformPoint
+    /// on each point, but it is much faster for large arrays:
+    /// it processes several points at once where the processor
+    /// supports it (SSE).
+    ///
+    /// \a points and \a result may be the same array.
+    ///
+    /// \param points Points to transform
+    /// \param result Array that receives the transformed points
+    /// \param count  Number of points
+    ///
+    ////////////////////////////////////////////////////////////
+    void transformPoints(const Vector2f* points, Vector2f* result, std::size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform the positions of an array of vertices
+    ///
+    /// The vertices are copied to \a result with their position
+    /// transformed; their color and texture coordinates are
+    /// left unchanged. Like transformPoints, several vertices
+    /// are processed at once where the processor supports it.
+    ///
+    /// \a vertices and \a result may be the same array.
+    ///
+    /// \param vertices Vertices to transform
+    /// \param result   Array that receives the transformed vertices
+    /// \param count    Number of vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    void transformVertices(const Vertex* vertices, Vertex* result, std::size_t count) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Transform a rectangle
     ///
@@ -319,6 +319,8 @@ private:
     Vector2f          m_origin;                     ///< Origin of translation/rotation/scaling of the object
     Vector2f          m_position;                   ///< Position of the object in the 2D world
     float             m_rotation;                   ///< Orientation of the object, in degrees
+    float             m_cosine;                     ///< Cosine of the rotation angle
+    float             m_sine;                       ///< Sine of the rotation angle
     Vector2f          m_scale;                      ///< Scale of the object
     mutable Transform m_transform;                  ///< Combined transformation of the object
     mutable bool      m_transformNeedUpdate;        ///< Does the transform need to be recomputed?
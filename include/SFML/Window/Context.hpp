@@ -88,6 +88,20 @@ public:
     ////////////////////////////////////////////////////////////
     static GlFunctionPointer getFunction(const char* name);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the unique identifier of the context active on the current thread
+    ///
+    /// Each context, including the ones owned by windows and
+    /// the internal ones created by SFML, has its own identifier.
+    /// Resources that can't be shared between contexts (like
+    /// frame buffer objects) can use it to know which
+    /// context they are used in.
+    ///
+    /// \return Identifier of the active context, or 0 if no context is active
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getActiveContextId();
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct a in-memory context
     ///
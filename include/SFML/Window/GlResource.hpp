@@ -29,6 +29,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/Export.hpp>
+#include <SFML/Config.hpp>
 
 
 namespace sf
@@ -58,6 +59,26 @@ protected:
     ///
     ////////////////////////////////////////////////////////////
     static void ensureGlContext();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Type of the functions called when a context is destroyed
+    ///
+    ////////////////////////////////////////////////////////////
+    typedef void (*ContextDestroyCallback)(Uint64 contextId);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Register a function to call when a context is destroyed
+    ///
+    /// This lets classes which keep data per context (see
+    /// sf::Context::getActiveContextId) release it. The context
+    /// is already gone when the function is called, so it must
+    /// not use OpenGL. Registering the same function twice has
+    /// no effect.
+    ///
+    /// \param callback Function to call, with the identifier of the destroyed context
+    ///
+    ////////////////////////////////////////////////////////////
+    static void registerContextDestroyCallback(ContextDestroyCallback callback);
 };
 
 } // namespace sf
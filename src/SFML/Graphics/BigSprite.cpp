@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/BigSprite.hpp>
+#include <SFML/Graphics/TiledTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/GridCulling.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+BigSprite::BigSprite() :
+m_texture(NULL),
+m_color  (Color::White)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+BigSprite::BigSprite(const TiledTexture& texture) :
+m_texture(&texture),
+m_color  (Color::White)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void BigSprite::setTexture(const TiledTexture& texture)
+{
+    m_texture = &texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void BigSprite::setColor(const Color& color)
+{
+    m_color = color;
+}
+
+
+////////////////////////////////////////////////////////////
+const TiledTexture* BigSprite::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Color& BigSprite::getColor() const
+{
+    return m_color;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect BigSprite::getLocalBounds() const
+{
+    if (!m_texture)
+        return FloatRect();
+
+    Vector2u size = m_texture->getSize();
+
+    return FloatRect(0.f, 0.f, static_cast<float>(size.x), static_cast<float>(size.y));
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect BigSprite::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void BigSprite::draw(RenderTarget& target, RenderStates states) const
+{
+    if (!m_texture || (m_texture->getTileSize() == 0))
+        return;
+
+    states.transform *= getTransform();
+
+    // Find the tiles which are covered by the view
+    float    tileSize = static_cast<float>(m_texture->getTileSize());
+    Vector2u first;
+    Vector2u last;
+    if (!priv::findVisibleCells(target, states.transform, Vector2f(tileSize, tileSize), m_texture->getTileCount(), first, last))
+        return;
+
+    // Draw the visible tiles, uploading the ones that were never seen
+    for (unsigned int row = first.y; row <= last.y; ++row)
+    {
+        for (unsigned int column = first.x; column <= last.x; ++column)
+        {
+            const Texture* tile = m_texture->getTile(column, row);
+            if (!tile)
+                continue;
+
+            // The pixels of the tile start after the 1 pixel border of its texture
+            FloatRect rect(m_texture->getTileRect(column, row));
+            float tileRight  = rect.left + rect.width;
+            float tileBottom = rect.top + rect.height;
+            float texRight   = 1.f + rect.width;
+            float texBottom  = 1.f + rect.height;
+
+            Vertex vertices[4] =
+            {
+                Vertex(Vector2f(rect.left, rect.top),   m_color, Vector2f(1.f, 1.f)),
+                Vertex(Vector2f(rect.left, tileBottom), m_color, Vector2f(1.f, texBottom)),
+                Vertex(Vector2f(tileRight, rect.top),   m_color, Vector2f(texRight, 1.f)),
+                Vertex(Vector2f(tileRight, tileBottom), m_color, Vector2f(texRight, texBottom))
+            };
+
+            states.texture = tile;
+            target.draw(vertices, 4, TrianglesStrip, states);
+        }
+    }
+}
+
+} // namespace sf
@@ -26,7 +26,44 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
 #include <cmath>
+#include <map>
+#include <vector>
+
+
+namespace
+{
+    // Unit circles shared by all the circle shapes, indexed by point count
+    sf::Mutex unitCirclesMutex;
+    std::map<std::size_t, std::vector<sf::Vector2f> > unitCircles;
+
+    // Get the points of a circle inscribed in the [0, 1] square
+    const std::vector<sf::Vector2f>& getUnitCircle(std::size_t pointCount)
+    {
+        sf::Lock lock(unitCirclesMutex);
+
+        // Vectors are filled once and never modified afterwards, and the
+        // elements of a map are never moved: the reference remains valid
+        // and can be read without locking
+        std::vector<sf::Vector2f>& points = unitCircles[pointCount];
+        if (points.empty() && (pointCount > 0))
+        {
+            static const float pi = 3.141592654f;
+
+            points.resize(pointCount);
+            for (std::size_t i = 0; i < pointCount; ++i)
+            {
+                float angle = i * 2 * pi / pointCount - pi / 2;
+                points[i].x = 0.5f + std::cos(angle) * 0.5f;
+                points[i].y = 0.5f + std::sin(angle) * 0.5f;
+            }
+        }
+
+        return points;
+    }
+}
 
 
 namespace sf
@@ -34,9 +71,10 @@ namespace sf
 ////////////////////////////////////////////////////////////
 CircleShape::CircleShape(float radius, std::size_t pointCount) :
 m_radius    (radius),
-m_pointCount(pointCount)
+m_pointCount(pointCount),
+m_unitCircle(&getUnitCircle(pointCount))
 {
-    update();
+    updateGeometry();
 }
 
 
@@ -44,7 +82,7 @@ m_pointCount(pointCount)
 void CircleShape::setRadius(float radius)
 {
     m_radius = radius;
-    update();
+    updateGeometry();
 }
 
 
@@ -59,9 +97,11 @@ float CircleShape::getRadius() const
 void CircleShape::setPointCount(std::size_t count)
 {
     m_pointCount = count;
-    update();
+    m_unitCircle = &getUnitCircle(count);
+    updateGeometry();
 }
 
+
 ////////////////////////////////////////////////////////////
 std::size_t CircleShape::getPointCount() const
 {
@@ -72,13 +112,18 @@ std::size_t CircleShape::getPointCount() const
 ////////////////////////////////////////////////////////////
 Vector2f CircleShape::getPoint(std::size_t index) const
 {
-    static const float pi = 3.141592654f;
+    const Vector2f& point = (*m_unitCircle)[index];
+
+    return Vector2f(point.x * m_radius * 2, point.y * m_radius * 2);
+}
 
-    float angle = index * 2 * pi / m_pointCount - pi / 2;
-    float x = std::cos(angle) * m_radius;
-    float y = std::sin(angle) * m_radius;
 
-    return Vector2f(m_radius + x, m_radius + y);
+////////////////////////////////////////////////////////////
+void CircleShape::updateGeometry()
+{
+    const std::vector<Vector2f>& points = *m_unitCircle;
+
+    update(points.empty() ? NULL : &points[0], points.size(), Vector2f(m_radius * 2, m_radius * 2));
 }
 
 } // namespace sf
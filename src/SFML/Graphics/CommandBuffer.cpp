@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CommandBuffer.hpp>
+#include <SFML/Graphics/PrimitiveList.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+CommandBuffer::CommandBuffer() :
+m_size    (0, 0),
+m_commands(),
+m_vertices()
+{
+    initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+CommandBuffer::CommandBuffer(const Vector2u& size) :
+m_size    (size),
+m_commands(),
+m_vertices()
+{
+    initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandBuffer::setSize(const Vector2u& size)
+{
+    m_size = size;
+
+    // Update the default view
+    initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u CommandBuffer::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandBuffer::draw(const Vertex* vertices, std::size_t vertexCount,
+                         PrimitiveType type, const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0))
+        return;
+
+    // Transform the vertices now, and convert strips and fans to lists,
+    // so that the draw can be merged with the previous one
+    std::size_t first = m_vertices.size();
+    PrimitiveType listType = priv::appendPrimitives(m_vertices, vertices, vertexCount, type, states.transform);
+    std::size_t count = m_vertices.size() - first;
+    if (count == 0)
+        return;
+
+    // Merge with the previous command if the states are the same
+    if (!m_commands.empty())
+    {
+        Command& previous = m_commands.back();
+        if ((previous.type             == listType)         &&
+            (previous.states.shader    == states.shader)    &&
+            (previous.states.texture   == states.texture)   &&
+            (previous.states.blendMode == states.blendMode))
+        {
+            previous.count += count;
+            return;
+        }
+    }
+
+    Command command;
+    command.states           = states;
+    command.states.transform = Transform::Identity;
+    command.type             = listType;
+    command.first            = first;
+    command.count            = count;
+    m_commands.push_back(command);
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandBuffer::replay(RenderTarget& target) const
+{
+    for (std::vector<Command>::const_iterator it = m_commands.begin(); it != m_commands.end(); ++it)
+        target.draw(&m_vertices[it->first], it->count, it->type, it->states);
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandBuffer::reset()
+{
+    m_commands.clear();
+    m_vertices.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CommandBuffer::getCommandCount() const
+{
+    return m_commands.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool CommandBuffer::activate(bool)
+{
+    return false;
+}
+
+} // namespace sf
@@ -37,6 +37,11 @@
 #include FT_GLYPH_H
 #include FT_OUTLINE_H
 #include FT_BITMAP_H
+#ifdef SFML_USE_HARFBUZZ
+    #include <hb.h>
+    #include <hb-ft.h>
+#endif
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -60,6 +65,56 @@ namespace
     void close(FT_Stream)
     {
     }
+
+    // Build the key of a glyph in the glyph table of a page; code points and glyph
+    // indices share the same table, so they are told apart by a flag, glyph indices
+    // are combined with the face which contains them (bits 21 to 24), and glyphs
+    // rendered for subpixel positioning are combined with their phase (bits 25 to 27)
+    sf::Uint32 glyphKey(sf::Uint32 value, bool bold, bool isIndex, std::size_t face = 0, sf::Uint32 variant = 0)
+    {
+        return (static_cast<sf::Uint32>(bold) << 31) | (static_cast<sf::Uint32>(isIndex) << 30) | (variant << 25) | (static_cast<sf::Uint32>(face) << 21) | value;
+    }
+
+    // Get the variant of a glyph rendered for a given subpixel phase
+    sf::Uint32 glyphVariant(bool subpixel, unsigned int phase)
+    {
+        return subpixel ? (4 | (phase & 3)) : 0;
+    }
+
+    // Get the FreeType flags used to load glyphs
+    FT_Int32 loadFlags(bool subpixel)
+    {
+        // Subpixel positioning only keeps the vertical hinting, which doesn't depend on the horizontal position
+        return (subpixel ? FT_LOAD_TARGET_LIGHT : FT_LOAD_TARGET_NORMAL) | FT_LOAD_FORCE_AUTOHINT;
+    }
+
+    // Maximum number of fallback fonts, limited by the bits available in the glyph keys
+    const std::size_t maxFallbacks = 15;
+
+    // Lock a mutex only when the font is in thread-safe mode
+    class ConditionalLock
+    {
+    public:
+
+        ConditionalLock(sf::Mutex& mutex, bool enabled) : m_mutex(enabled ? &mutex : NULL)
+        {
+            if (m_mutex)
+                m_mutex->lock();
+        }
+
+        ~ConditionalLock()
+        {
+            if (m_mutex)
+                m_mutex->unlock();
+        }
+
+    private:
+
+        sf::Mutex* m_mutex;
+    };
+
+    // Maximum number of shaped strings cached per character size
+    const std::size_t maxShapedRuns = 256;
 }
 
 
@@ -67,11 +122,13 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 Font::Font() :
-m_library  (NULL),
-m_face     (NULL),
-m_streamRec(NULL),
-m_refCount (NULL),
-m_info     ()
+m_library            (NULL),
+m_face               (NULL),
+m_streamRec          (NULL),
+m_refCount           (NULL),
+m_info               (),
+m_subpixelPositioning(false),
+m_threadSafe         (false)
 {
     #ifdef SFML_SYSTEM_ANDROID
         m_stream = NULL;
@@ -81,13 +138,15 @@ m_info     ()
 
 ////////////////////////////////////////////////////////////
 Font::Font(const Font& copy) :
-m_library    (copy.m_library),
-m_face       (copy.m_face),
-m_streamRec  (copy.m_streamRec),
-m_refCount   (copy.m_refCount),
-m_info       (copy.m_info),
-m_pages      (copy.m_pages),
-m_pixelBuffer(copy.m_pixelBuffer)
+m_library            (copy.m_library),
+m_face               (copy.m_face),
+m_streamRec          (copy.m_streamRec),
+m_refCount           (copy.m_refCount),
+m_info               (copy.m_info),
+m_pages              (copy.m_pages),
+m_fallbacks          (copy.m_fallbacks),
+m_subpixelPositioning(copy.m_subpixelPositioning),
+m_threadSafe         (copy.m_threadSafe)
 {
     #ifdef SFML_SYSTEM_ANDROID
         m_stream = NULL;
@@ -291,31 +350,16 @@ const Font::Info& Font::getInfo() const
 ////////////////////////////////////////////////////////////
 const Glyph& Font::getGlyph(Uint32 codePoint, unsigned int characterSize, bool bold) const
 {
-    // Get the page corresponding to the character size
-    GlyphTable& glyphs = m_pages[characterSize].glyphs;
-
-    // Build the key by combining the code point and the bold flag
-    Uint32 key = ((bold ? 1 : 0) << 31) | codePoint;
-
-    // Search the glyph into the cache
-    GlyphTable::const_iterator it = glyphs.find(key);
-    if (it != glyphs.end())
-    {
-        // Found: just return it
-        return it->second;
-    }
-    else
-    {
-        // Not found: we have to load it
-        Glyph glyph = loadGlyph(codePoint, characterSize, bold);
-        return glyphs.insert(std::make_pair(key, glyph)).first->second;
-    }
+    return getGlyph(codePoint, characterSize, bold, 0);
 }
 
 
 ////////////////////////////////////////////////////////////
 float Font::getKerning(Uint32 first, Uint32 second, unsigned int characterSize) const
 {
+    ConditionalLock lock(m_mutex, m_threadSafe);
+    ConditionalLock faceLock(m_faceMutex, m_threadSafe);
+
     // Special case where first or second is 0 (null character)
     if (first == 0 || second == 0)
         return 0.f;
@@ -328,9 +372,13 @@ float Font::getKerning(Uint32 first, Uint32 second, unsigned int characterSize)
         FT_UInt index1 = FT_Get_Char_Index(face, first);
         FT_UInt index2 = FT_Get_Char_Index(face, second);
 
-        // Get the kerning vector
+        // No kerning with characters that come from a fallback font
+        if (index1 == 0 || index2 == 0)
+            return 0.f;
+
+        // Get the kerning vector (keep it fractional for subpixel positioning)
         FT_Vector kerning;
-        FT_Get_Kerning(face, index1, index2, FT_KERNING_DEFAULT, &kerning);
+        FT_Get_Kerning(face, index1, index2, m_subpixelPositioning ? FT_KERNING_UNFITTED : FT_KERNING_DEFAULT, &kerning);
 
         // X advance is already in pixels for bitmap fonts
         if (!FT_IS_SCALABLE(face))
@@ -350,6 +398,9 @@ float Font::getKerning(Uint32 first, Uint32 second, unsigned int characterSize)
 ////////////////////////////////////////////////////////////
 float Font::getLineSpacing(unsigned int characterSize) const
 {
+    ConditionalLock lock(m_mutex, m_threadSafe);
+    ConditionalLock faceLock(m_faceMutex, m_threadSafe);
+
     FT_Face face = static_cast<FT_Face>(m_face);
 
     if (face && setCurrentSize(characterSize))
@@ -366,6 +417,9 @@ float Font::getLineSpacing(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 float Font::getUnderlinePosition(unsigned int characterSize) const
 {
+    ConditionalLock lock(m_mutex, m_threadSafe);
+    ConditionalLock faceLock(m_faceMutex, m_threadSafe);
+
     FT_Face face = static_cast<FT_Face>(m_face);
 
     if (face && setCurrentSize(characterSize))
@@ -386,6 +440,9 @@ float Font::getUnderlinePosition(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 float Font::getUnderlineThickness(unsigned int characterSize) const
 {
+    ConditionalLock lock(m_mutex, m_threadSafe);
+    ConditionalLock faceLock(m_faceMutex, m_threadSafe);
+
     FT_Face face = static_cast<FT_Face>(m_face);
 
     if (face && setCurrentSize(characterSize))
@@ -406,7 +463,94 @@ float Font::getUnderlineThickness(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 const Texture& Font::getTexture(unsigned int characterSize) const
 {
-    return m_pages[characterSize].texture;
+    ConditionalLock lock(m_mutex, m_threadSafe);
+
+    // Write the glyphs loaded since the last call
+    Page& page = m_pages[characterSize];
+    writePendingGlyphs(page);
+
+    return page.texture;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::addFallback(const Font& font)
+{
+    // Other threads may still use the cached glyphs that this would discard
+    if (m_threadSafe)
+    {
+        err() << "Failed to add a fallback font (fallbacks can't be changed in thread-safe mode)" << std::endl;
+        return false;
+    }
+
+    if (m_fallbacks.size() >= maxFallbacks)
+    {
+        err() << "Failed to add a fallback font (the maximum of " << maxFallbacks << " fallbacks is reached)" << std::endl;
+        return false;
+    }
+
+    m_fallbacks.push_back(&font);
+
+    // Characters missing from the font must be resolved again; the glyphs
+    // stored by index stay valid, so no pixel is rendered twice
+    forgetResolvedGlyphs(false);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::clearFallbacks()
+{
+    // Other threads may still use the cached glyphs that this would discard
+    if (m_threadSafe)
+    {
+        err() << "Failed to clear the fallback fonts (fallbacks can't be changed in thread-safe mode)" << std::endl;
+        return;
+    }
+
+    m_fallbacks.clear();
+
+    // The glyphs of the old fallbacks must not be reused by new ones
+    forgetResolvedGlyphs(true);
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::setSubpixelPositioningEnabled(bool enabled)
+{
+    ConditionalLock lock(m_mutex, m_threadSafe);
+
+    if (m_subpixelPositioning != enabled)
+    {
+        m_subpixelPositioning = enabled;
+
+        // Shaped strings depend on the hinting mode; glyphs don't need to be
+        // discarded, since the variants of both modes are stored separately
+        for (PageTable::iterator page = m_pages.begin(); page != m_pages.end(); ++page)
+            page->second.runs.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isSubpixelPositioningEnabled() const
+{
+    return m_subpixelPositioning;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::setThreadSafe(bool threadSafe)
+{
+    m_threadSafe = threadSafe;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isThreadSafe() const
+{
+    return m_threadSafe;
 }
 
 
@@ -415,13 +559,15 @@ Font& Font::operator =(const Font& right)
 {
     Font temp(right);
 
-    std::swap(m_library,     temp.m_library);
-    std::swap(m_face,        temp.m_face);
-    std::swap(m_streamRec,   temp.m_streamRec);
-    std::swap(m_refCount,    temp.m_refCount);
-    std::swap(m_info,        temp.m_info);
-    std::swap(m_pages,       temp.m_pages);
-    std::swap(m_pixelBuffer, temp.m_pixelBuffer);
+    std::swap(m_library,             temp.m_library);
+    std::swap(m_face,                temp.m_face);
+    std::swap(m_streamRec,           temp.m_streamRec);
+    std::swap(m_refCount,            temp.m_refCount);
+    std::swap(m_info,                temp.m_info);
+    std::swap(m_pages,               temp.m_pages);
+    std::swap(m_fallbacks,           temp.m_fallbacks);
+    std::swap(m_subpixelPositioning, temp.m_subpixelPositioning);
+    std::swap(m_threadSafe,          temp.m_threadSafe);
 
     return *this;
 }
@@ -462,27 +608,290 @@ void Font::cleanup()
     m_streamRec = NULL;
     m_refCount  = NULL;
     m_pages.clear();
-    m_pixelBuffer.clear();
 }
 
 
 ////////////////////////////////////////////////////////////
-Glyph Font::loadGlyph(Uint32 codePoint, unsigned int characterSize, bool bold) const
+void Font::forgetResolvedGlyphs(bool fallbackGlyphs)
+{
+    const Uint32 indexFlag = glyphKey(0, false, true);
+    const Uint32 faceMask  = glyphKey(0, false, false, maxFallbacks);
+
+    for (PageTable::iterator page = m_pages.begin(); page != m_pages.end(); ++page)
+    {
+        GlyphTable& glyphs = page->second.glyphs;
+        for (GlyphTable::iterator it = glyphs.begin(); it != glyphs.end();)
+        {
+            bool byCodePoint = (it->first & indexFlag) == 0;
+            bool inFallback  = (it->first & faceMask) != 0;
+            if (byCodePoint || (fallbackGlyphs && inFallback))
+                glyphs.erase(it++);
+            else
+                ++it;
+        }
+
+        page->second.runs.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph& Font::getGlyph(Uint32 codePoint, unsigned int characterSize, bool bold, unsigned int phase) const
+{
+    // Cached glyphs are never modified nor removed in thread-safe mode (addFallback and
+    // clearFallbacks are refused), so the returned reference remains valid after the lock is released
+    ConditionalLock lock(m_mutex, m_threadSafe);
+
+    // Get the page corresponding to the character size
+    GlyphTable& glyphs = m_pages[characterSize].glyphs;
+
+    // Build the key by combining the code point, the bold flag and the subpixel variant
+    Uint32 key = glyphKey(codePoint, bold, false, 0, glyphVariant(m_subpixelPositioning, phase));
+
+    // Search the glyph into the cache
+    GlyphTable::const_iterator it = glyphs.find(key);
+    if (it != glyphs.end())
+    {
+        // Found: just return it
+        return it->second;
+    }
+    else
+    {
+        // Not found: convert the code point to a glyph index, so that the pixels of
+        // the glyph are shared with the shaped text (the glyph may come from a fallback)
+        Uint32 index = 0;
+        std::size_t face = findFace(codePoint, index);
+
+        Glyph glyph = getGlyphByIndex(index, characterSize, bold, face, phase);
+        return glyphs.insert(std::make_pair(key, glyph)).first->second;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Font::findFace(Uint32 codePoint, Uint32& glyphIndex) const
+{
+    {
+        ConditionalLock faceLock(m_faceMutex, m_threadSafe);
+
+        FT_Face face = static_cast<FT_Face>(m_face);
+        glyphIndex = face ? FT_Get_Char_Index(face, codePoint) : 0;
+        if (glyphIndex != 0)
+            return 0;
+    }
+
+    // Not in this font: look into the fallbacks
+    for (std::size_t i = 0; i < m_fallbacks.size(); ++i)
+    {
+        const Font& fallback = *m_fallbacks[i];
+        ConditionalLock faceLock(fallback.m_faceMutex, fallback.m_threadSafe);
+
+        FT_Face fallbackFace = static_cast<FT_Face>(fallback.m_face);
+        glyphIndex = fallbackFace ? FT_Get_Char_Index(fallbackFace, codePoint) : 0;
+        if (glyphIndex != 0)
+            return i + 1;
+    }
+
+    // Not found anywhere: use the "missing glyph" of this font
+    glyphIndex = 0;
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph& Font::getGlyphByIndex(Uint32 glyphIndex, unsigned int characterSize, bool bold, std::size_t face, unsigned int phase) const
+{
+    ConditionalLock lock(m_mutex, m_threadSafe);
+
+    // Get the page corresponding to the character size
+    GlyphTable& glyphs = m_pages[characterSize].glyphs;
+
+    // Build the key by combining the glyph index, the face, the bold flag and the subpixel variant
+    Uint32 key = glyphKey(glyphIndex, bold, true, face, glyphVariant(m_subpixelPositioning, phase));
+
+    // Search the glyph into the cache
+    GlyphTable::const_iterator it = glyphs.find(key);
+    if (it != glyphs.end())
+    {
+        // Found: just return it
+        return it->second;
+    }
+    else
+    {
+        // Not found: we have to load it
+        const Font& source = (face > 0) && (face <= m_fallbacks.size()) ? *m_fallbacks[face - 1] : *this;
+        Glyph glyph = loadGlyph(source, glyphIndex, characterSize, bold, phase);
+        return glyphs.insert(std::make_pair(key, glyph)).first->second;
+    }
+}
+
+
+#ifdef SFML_USE_HARFBUZZ
+
+////////////////////////////////////////////////////////////
+bool Font::shape(const Uint32* codePoints, std::size_t count, unsigned int characterSize, bool bold, ShapedRun& result) const
+{
+    ConditionalLock lock(m_mutex, m_threadSafe);
+
+    // Shaping is only supported for scalable fonts
+    FT_Face face = static_cast<FT_Face>(m_face);
+    if (!face || !FT_IS_SCALABLE(face))
+        return false;
+
+    // Hash the string (FNV-1a) to find it in the cache
+    Uint32 hash = 2166136261u ^ static_cast<Uint32>(bold);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        hash ^= codePoints[i];
+        hash *= 16777619u;
+    }
+
+    // Return the cached run, unless it is a hash collision
+    ShapedRunTable& runs = m_pages[characterSize].runs;
+    ShapedRunTable::iterator it = runs.find(hash);
+    if (it != runs.end())
+    {
+        const ShapedRun& run = it->second;
+        if ((run.bold == bold) && (run.codePoints.size() == count) && std::equal(codePoints, codePoints + count, run.codePoints.begin()))
+        {
+            result = run;
+            return true;
+        }
+    }
+
+    // Keep the cache bounded
+    if ((it == runs.end()) && (runs.size() >= maxShapedRuns))
+        runs.clear();
+
+    // Shape the string; HarfBuzz loads the glyphs with the same flags as loadGlyph, so that advances match
+    hb_buffer_t* buffer = hb_buffer_create();
+    hb_buffer_add_utf32(buffer, codePoints, static_cast<int>(count), 0, static_cast<int>(count));
+    hb_buffer_guess_segment_properties(buffer);
+
+    hb_font_t* font = NULL;
+    {
+        // The face is only used while shaping: the lock is released before loading glyphs,
+        // which may lock the face of a fallback font
+        ConditionalLock faceLock(m_faceMutex, m_threadSafe);
+
+        if (!setCurrentSize(characterSize))
+        {
+            hb_buffer_destroy(buffer);
+            return false;
+        }
+
+        font = hb_ft_font_create(face, NULL);
+        hb_ft_font_set_load_flags(font, loadFlags(m_subpixelPositioning));
+        hb_shape(font, buffer, NULL, 0);
+    }
+
+    unsigned int glyphCount = 0;
+    const hb_glyph_info_t*     infos     = hb_buffer_get_glyph_infos(buffer, &glyphCount);
+    const hb_glyph_position_t* positions = hb_buffer_get_glyph_positions(buffer, &glyphCount);
+
+    ShapedRun& run = runs[hash];
+    run.codePoints.assign(codePoints, codePoints + count);
+    run.bold = bold;
+    run.rightToLeft = (hb_buffer_get_direction(buffer) == HB_DIRECTION_RTL);
+    run.glyphs.clear();
+    run.advances.assign(count, 0.f);
+
+    // Glyphs are returned in visual order: group them by cluster...
+    std::vector<std::pair<unsigned int, unsigned int> > clusters;
+    for (unsigned int i = 0; i < glyphCount; ++i)
+    {
+        if ((i == 0) || (infos[i].cluster != infos[i - 1].cluster))
+            clusters.push_back(std::make_pair(i, i + 1));
+        else
+            clusters.back().second = i + 1;
+    }
+
+    // ... and store the clusters in logical order, with the glyph positions relative to their cluster
+    if (run.rightToLeft)
+        std::reverse(clusters.begin(), clusters.end());
+
+    float weight = bold ? 1.f : 0.f; // same as the emboldening applied by loadGlyph
+    for (std::vector<std::pair<unsigned int, unsigned int> >::const_iterator cluster = clusters.begin(); cluster != clusters.end(); ++cluster)
+    {
+        std::size_t character = infos[cluster->first].cluster;
+        float pen = 0.f;
+        for (unsigned int i = cluster->first; i < cluster->second; ++i)
+        {
+            ShapedGlyph glyph;
+            glyph.index     = infos[i].codepoint;
+            glyph.face      = 0;
+            glyph.character = character;
+            glyph.offset.x  = pen + static_cast<float>(positions[i].x_offset) / static_cast<float>(1 << 6);
+            glyph.offset.y  = -static_cast<float>(positions[i].y_offset) / static_cast<float>(1 << 6);
+
+            // Characters missing from the font are taken from the fallbacks, unshaped
+            if ((glyph.index == 0) && (character < count))
+            {
+                glyph.face = findFace(codePoints[character], glyph.index);
+                if (glyph.face > 0)
+                {
+                    glyph.offset.x = pen;
+                    glyph.offset.y = 0.f;
+                    run.glyphs.push_back(glyph);
+
+                    pen += getGlyphByIndex(glyph.index, characterSize, bold, glyph.face).advance;
+                    continue;
+                }
+            }
+
+            run.glyphs.push_back(glyph);
+
+            pen += static_cast<float>(positions[i].x_advance) / static_cast<float>(1 << 6) + weight;
+        }
+
+        if (character < count)
+            run.advances[character] = pen;
+    }
+
+    hb_font_destroy(font);
+    hb_buffer_destroy(buffer);
+
+    result = run;
+    return true;
+}
+
+#else
+
+////////////////////////////////////////////////////////////
+bool Font::shape(const Uint32*, std::size_t, unsigned int, bool, ShapedRun&) const
+{
+    // Shaping is not available without HarfBuzz
+    return false;
+}
+
+#endif
+
+
+////////////////////////////////////////////////////////////
+Glyph Font::loadGlyph(const Font& source, Uint32 glyphIndex, unsigned int characterSize, bool bold, unsigned int phase) const
 {
     // The glyph to return
     Glyph glyph;
 
     // First, transform our ugly void* to a FT_Face
-    FT_Face face = static_cast<FT_Face>(m_face);
+    FT_Face face = static_cast<FT_Face>(source.m_face);
     if (!face)
         return glyph;
 
+    // The face may be used by other threads as well (directly, or as a fallback of another font);
+    // no other mutex is locked while the face mutex is held, so fonts which fall back to each
+    // other can't deadlock
+    ConditionalLock faceLock(source.m_faceMutex, source.m_threadSafe);
+
     // Set the character size
-    if (!setCurrentSize(characterSize))
+    if (!source.setCurrentSize(characterSize))
         return glyph;
 
-    // Load the glyph corresponding to the code point
-    if (FT_Load_Char(face, codePoint, FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT) != 0)
+    // Subpixel positioning is only possible with outlines
+    bool subpixel = m_subpixelPositioning && FT_IS_SCALABLE(face);
+
+    // Load the glyph corresponding to the index
+    if (FT_Load_Glyph(face, glyphIndex, loadFlags(subpixel)) != 0)
         return glyph;
 
     // Retrieve the glyph
@@ -499,6 +908,15 @@ Glyph Font::loadGlyph(Uint32 codePoint, unsigned int characterSize, bool bold) c
         FT_Outline_Embolden(&outlineGlyph->outline, weight);
     }
 
+    // Shift the outline by the fractional part of the pen position
+    if (subpixel && outline && ((phase & 3) != 0))
+    {
+        FT_Vector delta;
+        delta.x = static_cast<FT_Pos>(phase & 3) * (1 << 6) / 4;
+        delta.y = 0;
+        FT_Glyph_Transform(glyphDesc, NULL, &delta);
+    }
+
     // Convert the glyph to a bitmap (i.e. rasterize it)
     FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, 0, 1);
     FT_Bitmap& bitmap = reinterpret_cast<FT_BitmapGlyph>(glyphDesc)->bitmap;
@@ -506,11 +924,14 @@ Glyph Font::loadGlyph(Uint32 codePoint, unsigned int characterSize, bool bold) c
     // Apply bold if necessary -- fallback technique using bitmap (lower quality)
     if (bold && !outline)
     {
-        FT_Bitmap_Embolden(static_cast<FT_Library>(m_library), &bitmap, weight, weight);
+        FT_Bitmap_Embolden(static_cast<FT_Library>(source.m_library), &bitmap, weight, weight);
     }
 
-    // Compute the glyph's advance offset
-    glyph.advance = static_cast<float>(face->glyph->metrics.horiAdvance) / static_cast<float>(1 << 6);
+    // Compute the glyph's advance offset (unhinted and fractional for subpixel positioning)
+    if (subpixel)
+        glyph.advance = static_cast<float>(face->glyph->linearHoriAdvance) / static_cast<float>(1 << 16);
+    else
+        glyph.advance = static_cast<float>(face->glyph->metrics.horiAdvance) / static_cast<float>(1 << 6);
     if (bold)
         glyph.advance += static_cast<float>(weight) / static_cast<float>(1 << 6);
 
@@ -536,14 +957,32 @@ Glyph Font::loadGlyph(Uint32 codePoint, unsigned int characterSize, bool bold) c
         glyph.textureRect.width -= 2 * padding;
         glyph.textureRect.height -= 2 * padding;
 
-        // Compute the glyph's bounding box
-        glyph.bounds.left   = static_cast<float>(face->glyph->metrics.horiBearingX) / static_cast<float>(1 << 6);
-        glyph.bounds.top    = -static_cast<float>(face->glyph->metrics.horiBearingY) / static_cast<float>(1 << 6);
-        glyph.bounds.width  = static_cast<float>(face->glyph->metrics.width) / static_cast<float>(1 << 6);
-        glyph.bounds.height = static_cast<float>(face->glyph->metrics.height) / static_cast<float>(1 << 6);
+        // Compute the glyph's bounding box; shifted glyphs use the rasterized bitmap,
+        // so that the pixels map exactly to the texels relative to an integer pen position
+        if (subpixel)
+        {
+            FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+            glyph.bounds.left   = static_cast<float>(bitmapGlyph->left);
+            glyph.bounds.top    = -static_cast<float>(bitmapGlyph->top);
+            glyph.bounds.width  = static_cast<float>(width);
+            glyph.bounds.height = static_cast<float>(height);
+        }
+        else
+        {
+            glyph.bounds.left   = static_cast<float>(face->glyph->metrics.horiBearingX) / static_cast<float>(1 << 6);
+            glyph.bounds.top    = -static_cast<float>(face->glyph->metrics.horiBearingY) / static_cast<float>(1 << 6);
+            glyph.bounds.width  = static_cast<float>(face->glyph->metrics.width) / static_cast<float>(1 << 6);
+            glyph.bounds.height = static_cast<float>(face->glyph->metrics.height) / static_cast<float>(1 << 6);
+        }
+
+        // Queue the glyph's pixels; they are written to the texture by getTexture,
+        // so that no OpenGL call is made here (this may run in any thread)
+        page.pending.push_back(PendingGlyph());
+        PendingGlyph& pending = page.pending.back();
+        pending.rect = glyph.textureRect;
 
         // Extract the glyph's pixels from the bitmap
-        m_pixelBuffer.resize(width * height * 4, 255);
+        pending.pixels.resize(width * height * 4, 255);
         const Uint8* pixels = bitmap.buffer;
         if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
         {
@@ -554,7 +993,7 @@ Glyph Font::loadGlyph(Uint32 codePoint, unsigned int characterSize, bool bold) c
                 {
                     // The color channels remain white, just fill the alpha channel
                     std::size_t index = (x + y * width) * 4 + 3;
-                    m_pixelBuffer[index] = ((pixels[x / 8]) & (1 << (7 - (x % 8)))) ? 255 : 0;
+                    pending.pixels[index] = ((pixels[x / 8]) & (1 << (7 - (x % 8)))) ? 255 : 0;
                 }
                 pixels += bitmap.pitch;
             }
@@ -568,29 +1007,59 @@ Glyph Font::loadGlyph(Uint32 codePoint, unsigned int characterSize, bool bold) c
                 {
                     // The color channels remain white, just fill the alpha channel
                     std::size_t index = (x + y * width) * 4 + 3;
-                    m_pixelBuffer[index] = pixels[x];
+                    pending.pixels[index] = pixels[x];
                 }
                 pixels += bitmap.pitch;
             }
         }
-
-        // Write the pixels to the texture
-        unsigned int x = glyph.textureRect.left;
-        unsigned int y = glyph.textureRect.top;
-        unsigned int w = glyph.textureRect.width;
-        unsigned int h = glyph.textureRect.height;
-        page.texture.update(&m_pixelBuffer[0], w, h, x, y);
     }
 
     // Delete the FT glyph
     FT_Done_Glyph(glyphDesc);
 
+    // Done :)
+    return glyph;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::writePendingGlyphs(Page& page) const
+{
+    // Nothing to do if the texture is up to date
+    if (page.pending.empty() && (page.texture.getSize() == page.size))
+        return;
+
+    // Create the texture, or enlarge it if new glyphs didn't fit in it
+    if (page.texture.getSize() != page.size)
+    {
+        Image image;
+        image.create(page.size.x, page.size.y, Color(255, 255, 255, 0));
+
+        if (page.texture.getSize().x > 0)
+        {
+            // Keep the glyphs already written
+            image.copy(page.texture.copyToImage(), 0, 0);
+        }
+        else
+        {
+            // Reserve a 2x2 white square for texturing underlines
+            for (int x = 0; x < 2; ++x)
+                for (int y = 0; y < 2; ++y)
+                    image.setPixel(x, y, Color(255, 255, 255, 255));
+        }
+
+        page.texture.loadFromImage(image);
+        page.texture.setSmooth(true);
+    }
+
+    // Write the pixels of the new glyphs
+    for (std::vector<PendingGlyph>::const_iterator it = page.pending.begin(); it != page.pending.end(); ++it)
+        page.texture.update(&it->pixels[0], it->rect.width, it->rect.height, it->rect.left, it->rect.top);
+    page.pending.clear();
+
     // Force an OpenGL flush, so that the font's texture will appear updated
     // in all contexts immediately (solves problems in multi-threaded apps)
     glCheck(glFlush());
-
-    // Done :)
-    return glyph;
 }
 
 
@@ -609,7 +1078,7 @@ IntRect Font::findGlyphRect(Page& page, unsigned int width, unsigned int height)
             continue;
 
         // Check if there's enough horizontal space left in the row
-        if (width > page.texture.getSize().x - it->width)
+        if (width > page.size.x - it->width)
             continue;
 
         // Make sure that this new row is the best found so far
@@ -625,18 +1094,14 @@ IntRect Font::findGlyphRect(Page& page, unsigned int width, unsigned int height)
     if (!row)
     {
         int rowHeight = height + height / 10;
-        while ((page.nextRow + rowHeight >= page.texture.getSize().y) || (width >= page.texture.getSize().x))
+        while ((page.nextRow + rowHeight >= page.size.y) || (width >= page.size.x))
         {
-            // Not enough space: resize the texture if possible
-            unsigned int textureWidth  = page.texture.getSize().x;
-            unsigned int textureHeight = page.texture.getSize().y;
-            if ((textureWidth * 2 <= Texture::getMaximumSize()) && (textureHeight * 2 <= Texture::getMaximumSize()))
+            // Not enough space: resize the texture if possible (the actual
+            // texture is resized when the pending glyphs are written)
+            if ((page.size.x * 2 <= Texture::getMaximumSize()) && (page.size.y * 2 <= Texture::getMaximumSize()))
             {
                 // Make the texture 2 times bigger
-                Image newImage;
-                newImage.create(textureWidth * 2, textureHeight * 2, Color(255, 255, 255, 0));
-                newImage.copy(page.texture.copyToImage(), 0, 0);
-                page.texture.loadFromImage(newImage);
+                page.size *= 2u;
             }
             else
             {
@@ -700,20 +1165,10 @@ bool Font::setCurrentSize(unsigned int characterSize) const
 
 ////////////////////////////////////////////////////////////
 Font::Page::Page() :
+size   (128, 128),
 nextRow(3)
 {
-    // Make sure that the texture is initialized by default
-    sf::Image image;
-    image.create(128, 128, Color(255, 255, 255, 0));
-
-    // Reserve a 2x2 white square for texturing underlines
-    for (int x = 0; x < 2; ++x)
-        for (int y = 0; y < 2; ++y)
-            image.setPixel(x, y, Color(255, 255, 255, 255));
-
-    // Create the texture
-    texture.loadFromImage(image);
-    texture.setSmooth(true);
+    // The texture is created when the page is first written to it
 }
 
 } // namespace sf
@@ -0,0 +1,312 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/FrameRecorder.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/ImageLoader.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <SFML/System/Err.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+FrameRecorder::FrameRecorder() :
+m_thread       (&FrameRecorder::saveFrames, this),
+m_mutex        (),
+m_isRecording  (false),
+m_path         (),
+m_format       (PngSequence),
+m_settings     (),
+m_file         (),
+m_frames       (),
+m_first        (0),
+m_count        (0),
+m_capturedCount(0),
+m_savedCount   (0),
+m_droppedCount (0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+FrameRecorder::~FrameRecorder()
+{
+    stop();
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::start(const std::string& path, Format format, std::size_t capacity, const Image::EncodingSettings& settings)
+{
+    // Stop the current recording, if any
+    stop();
+
+    if (capacity == 0)
+    {
+        err() << "Failed to start recording, the capacity of the frame queue must not be 0" << std::endl;
+        return false;
+    }
+
+    if (format == RawDump)
+    {
+        m_file.clear();
+        m_file.open(path.c_str(), std::ios_base::binary | std::ios_base::trunc);
+        if (!m_file.is_open())
+        {
+            err() << "Failed to start recording, cannot open \"" << path << "\"" << std::endl;
+            return false;
+        }
+    }
+
+    m_path     = path;
+    m_format   = format;
+    m_settings = settings;
+
+    // The frames keep their buffers from the previous recordings
+    m_frames.resize(capacity);
+    m_first         = 0;
+    m_count         = 0;
+    m_capturedCount = 0;
+    m_savedCount    = 0;
+    m_droppedCount  = 0;
+
+    m_isRecording = true;
+    m_thread.launch();
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameRecorder::stop()
+{
+    {
+        Lock lock(m_mutex);
+        m_isRecording = false;
+    }
+
+    // The thread saves the remaining frames before it finishes; it may
+    // also have stopped the recording by itself, after a failure
+    m_thread.wait();
+
+    if (m_file.is_open())
+        m_file.close();
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::isRecording() const
+{
+    Lock lock(m_mutex);
+
+    return m_isRecording;
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::capture(const RenderWindow& window)
+{
+    Vector2u size = window.getSize();
+    if ((size.x == 0) || (size.y == 0))
+        return false;
+
+    Frame* frame = acquireFrame();
+    if (!frame || !window.setActive())
+        return false;
+
+    // Read all the rows at once; the background thread will put them back in order
+    frame->pixels.resize(size.x * size.y * 4);
+    glCheck(glReadPixels(0, 0, size.x, size.y, GL_RGBA, GL_UNSIGNED_BYTE, &frame->pixels[0]));
+    frame->size    = size;
+    frame->flipped = true;
+
+    return queueFrame();
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::capture(const Image& image)
+{
+    Vector2u size = image.getSize();
+    if ((size.x == 0) || (size.y == 0))
+        return false;
+
+    Frame* frame = acquireFrame();
+    if (!frame)
+        return false;
+
+    const Uint8* pixels = image.getPixelsPtr();
+    frame->pixels.assign(pixels, pixels + size.x * size.y * 4);
+    frame->size    = size;
+    frame->flipped = false;
+
+    return queueFrame();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int FrameRecorder::getSavedFrameCount() const
+{
+    Lock lock(m_mutex);
+
+    return m_savedCount;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int FrameRecorder::getDroppedFrameCount() const
+{
+    Lock lock(m_mutex);
+
+    return m_droppedCount;
+}
+
+
+////////////////////////////////////////////////////////////
+FrameRecorder::Frame* FrameRecorder::acquireFrame()
+{
+    Lock lock(m_mutex);
+
+    if (!m_isRecording)
+        return NULL;
+
+    // Drop the capture if all the frames are waiting to be saved
+    if (m_count == m_frames.size())
+    {
+        m_droppedCount++;
+        return NULL;
+    }
+
+    // The frame after the last queued one is not touched by the background thread
+    return &m_frames[(m_first + m_count) % m_frames.size()];
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::queueFrame()
+{
+    Lock lock(m_mutex);
+
+    // The recording may have stopped since acquireFrame
+    if (!m_isRecording)
+    {
+        m_droppedCount++;
+        return false;
+    }
+
+    m_frames[(m_first + m_count) % m_frames.size()].number = m_capturedCount++;
+    m_count++;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameRecorder::saveFrames()
+{
+    for (;;)
+    {
+        Frame* frame = NULL;
+        bool isRecording = false;
+        {
+            Lock lock(m_mutex);
+            isRecording = m_isRecording;
+            if (m_count > 0)
+                frame = &m_frames[m_first];
+        }
+
+        if (frame)
+        {
+            // The frame stays in the queue while it's being saved, so that it's not reused
+            bool saved = saveFrame(*frame);
+
+            Lock lock(m_mutex);
+            if (saved)
+            {
+                m_first = (m_first + 1) % m_frames.size();
+                m_count--;
+                m_savedCount++;
+            }
+            else
+            {
+                // The next frames would most likely fail too: stop the recording and drop them
+                err() << "Failed to save frame " << frame->number << ", the recording is stopped" << std::endl;
+                m_droppedCount += static_cast<unsigned int>(m_count);
+                m_count = 0;
+                m_isRecording = false;
+            }
+        }
+        else if (isRecording)
+        {
+            // Wait for the next capture
+            sleep(milliseconds(5));
+        }
+        else
+        {
+            // The recording is stopped and all the frames are saved
+            break;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::saveFrame(Frame& frame)
+{
+    // Put the rows read from OpenGL back in top to bottom order
+    if (frame.flipped)
+    {
+        std::size_t rowSize = frame.size.x * 4;
+        Uint8* top = &frame.pixels[0];
+        Uint8* bottom = &frame.pixels[rowSize * (frame.size.y - 1)];
+        for (; top < bottom; top += rowSize, bottom -= rowSize)
+            std::swap_ranges(top, top + rowSize, bottom);
+
+        frame.flipped = false;
+    }
+
+    if (m_format == PngSequence)
+    {
+        std::ostringstream filename;
+        filename << m_path << std::setw(5) << std::setfill('0') << frame.number << ".png";
+        return priv::ImageLoader::getInstance().saveImageToFile(filename.str(), frame.pixels, frame.size, m_settings);
+    }
+    else
+    {
+        m_file.write(reinterpret_cast<const char*>(&frame.pixels[0]), static_cast<std::streamsize>(frame.pixels.size()));
+        return m_file.good();
+    }
+}
+
+} // namespace sf
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GridCulling.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
+#include <cmath>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+bool findVisibleCells(const RenderTarget& target, const Transform& transform, const Vector2f& cellSize,
+                      const Vector2u& cellCount, Vector2u& first, Vector2u& last)
+{
+    if ((cellCount.x == 0) || (cellCount.y == 0) || (cellSize.x <= 0.f) || (cellSize.y <= 0.f))
+        return false;
+
+    // Compute the area of the grid which is covered by the view
+    const View& view = target.getView();
+    FloatRect viewArea = view.getInverseTransform().transformRect(FloatRect(-1.f, -1.f, 2.f, 2.f));
+    FloatRect area = transform.getInverse().transformRect(viewArea);
+
+    // Convert it to a range of cells
+    float left   = std::max(std::floor(area.left / cellSize.x), 0.f);
+    float top    = std::max(std::floor(area.top / cellSize.y), 0.f);
+    float right  = std::min(std::floor((area.left + area.width) / cellSize.x), cellCount.x - 1.f);
+    float bottom = std::min(std::floor((area.top + area.height) / cellSize.y), cellCount.y - 1.f);
+    if ((left > right) || (top > bottom))
+        return false;
+
+    first.x = static_cast<unsigned int>(left);
+    first.y = static_cast<unsigned int>(top);
+    last.x  = static_cast<unsigned int>(right);
+    last.y  = static_cast<unsigned int>(bottom);
+
+    return true;
+}
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_GRIDCULLING_HPP
+#define SFML_GRIDCULLING_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/System/Vector2.hpp>
+
+
+namespace sf
+{
+class RenderTarget;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Find the cells of a grid which are covered by the view of a target
+///
+/// The grid starts at (0, 0) in its local coordinates. This
+/// is used by the drawables made of many parts laid out on
+/// a grid, so that they only draw the visible ones.
+///
+/// \param target    Target whose current view is used
+/// \param transform Transform of the grid
+/// \param cellSize  Size of a cell, in local coordinates
+/// \param cellCount Number of columns and rows of the grid
+/// \param first     Receives the column and row of the top-left visible cell
+/// \param last      Receives the column and row of the bottom-right visible cell
+///
+/// \return True if at least one cell is visible
+///
+////////////////////////////////////////////////////////////
+bool findVisibleCells(const RenderTarget& target, const Transform& transform, const Vector2f& cellSize,
+                      const Vector2u& cellCount, Vector2u& first, Vector2u& last);
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_GRIDCULLING_HPP
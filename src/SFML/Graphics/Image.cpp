@@ -154,7 +154,21 @@ bool Image::loadFromStream(InputStream& stream)
 ////////////////////////////////////////////////////////////
 bool Image::saveToFile(const std::string& filename) const
 {
-    return priv::ImageLoader::getInstance().saveImageToFile(filename, m_pixels, m_size);
+    return priv::ImageLoader::getInstance().saveImageToFile(filename, m_pixels, m_size, EncodingSettings());
+}
+
+
+////////////////////////////////////////////////////////////
+bool Image::saveToFile(const std::string& filename, const EncodingSettings& settings) const
+{
+    return priv::ImageLoader::getInstance().saveImageToFile(filename, m_pixels, m_size, settings);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Image::saveToMemory(std::vector<Uint8>& output, const std::string& format, const EncodingSettings& settings) const
+{
+    return priv::ImageLoader::getInstance().saveImageToMemory(format, output, m_pixels, m_size, settings);
 }
 
 
@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/ImageLoader.hpp>
+#include <SFML/Graphics/PngEncoder.hpp>
 #include <SFML/System/InputStream.hpp>
 #include <SFML/System/Err.hpp>
 #define STB_IMAGE_IMPLEMENTATION
@@ -38,6 +39,7 @@ extern "C"
     #include <jerror.h>
 }
 #include <cctype>
+#include <cstdio>
 
 
 namespace
@@ -50,6 +52,15 @@ namespace
         return str;
     }
 
+    // Get the canonical name of an image format, from a format name or a file extension
+    std::string getFormat(const std::string& name)
+    {
+        std::string format = toLower(name);
+        if (format == "jpeg")
+            return "jpg";
+        return format;
+    }
+
     // stb_image callbacks that operate on a sf::InputStream
     int read(void* user, char* data, int size)
     {
@@ -66,6 +77,47 @@ namespace
         sf::InputStream* stream = static_cast<sf::InputStream*>(user);
         return stream->tell() >= stream->getSize();
     }
+
+    // libjpeg destination manager that appends to a std::vector
+    struct JpegDestination
+    {
+        jpeg_destination_mgr    manager;
+        std::vector<sf::Uint8>* output;
+        JOCTET                  buffer[4096];
+    };
+    void initDestination(j_compress_ptr infos)
+    {
+        JpegDestination* destination = reinterpret_cast<JpegDestination*>(infos->dest);
+        destination->manager.next_output_byte = destination->buffer;
+        destination->manager.free_in_buffer   = sizeof(destination->buffer);
+    }
+    boolean emptyOutputBuffer(j_compress_ptr infos)
+    {
+        JpegDestination* destination = reinterpret_cast<JpegDestination*>(infos->dest);
+        destination->output->insert(destination->output->end(), destination->buffer, destination->buffer + sizeof(destination->buffer));
+        destination->manager.next_output_byte = destination->buffer;
+        destination->manager.free_in_buffer   = sizeof(destination->buffer);
+        return TRUE;
+    }
+    void termDestination(j_compress_ptr infos)
+    {
+        JpegDestination* destination = reinterpret_cast<JpegDestination*>(infos->dest);
+        std::size_t count = sizeof(destination->buffer) - destination->manager.free_in_buffer;
+        destination->output->insert(destination->output->end(), destination->buffer, destination->buffer + count);
+    }
+
+    // Write a buffer to a file
+    bool writeFile(const std::string& filename, const std::vector<sf::Uint8>& data)
+    {
+        FILE* file = fopen(filename.c_str(), "wb");
+        if (!file)
+            return false;
+
+        bool success = fwrite(&data[0], 1, data.size(), file) == data.size();
+        fclose(file);
+
+        return success;
+    }
 }
 
 
@@ -221,16 +273,18 @@ bool ImageLoader::loadImageFromStream(InputStream& stream, std::vector<Uint8>& p
 
 
 ////////////////////////////////////////////////////////////
-bool ImageLoader::saveImageToFile(const std::string& filename, const std::vector<Uint8>& pixels, const Vector2u& size)
+bool ImageLoader::saveImageToFile(const std::string& filename, const std::vector<Uint8>& pixels, const Vector2u& size,
+                                  const Image::EncodingSettings& settings)
 {
     // Make sure the image is not empty
     if (!pixels.empty() && (size.x > 0) && (size.y > 0))
     {
         // Deduce the image type from its extension
-        if (filename.size() > 3)
+        std::string::size_type dot = filename.find_last_of('.');
+        if (dot != std::string::npos)
         {
             // Extract the extension
-            std::string extension = toLower(filename.substr(filename.size() - 3));
+            std::string extension = getFormat(filename.substr(dot + 1));
 
             if (extension == "bmp")
             {
@@ -244,16 +298,11 @@ bool ImageLoader::saveImageToFile(const std::string& filename, const std::vector
                 if (stbi_write_tga(filename.c_str(), size.x, size.y, 4, &pixels[0]))
                     return true;
             }
-            else if (extension == "png")
+            else if ((extension == "png") || (extension == "jpg"))
             {
-                // PNG format
-                if (stbi_write_png(filename.c_str(), size.x, size.y, 4, &pixels[0], 0))
-                    return true;
-            }
-            else if (extension == "jpg")
-            {
-                // JPG format
-                if (writeJpg(filename, pixels, size.x, size.y))
+                // PNG or JPG format: encode in memory, then write the file at once
+                std::vector<Uint8> buffer;
+                if (saveImageToMemory(extension, buffer, pixels, size, settings) && writeFile(filename, buffer))
                     return true;
             }
         }
@@ -265,13 +314,36 @@ bool ImageLoader::saveImageToFile(const std::string& filename, const std::vector
 
 
 ////////////////////////////////////////////////////////////
-bool ImageLoader::writeJpg(const std::string& filename, const std::vector<Uint8>& pixels, unsigned int width, unsigned int height)
+bool ImageLoader::saveImageToMemory(const std::string& format, std::vector<Uint8>& output, const std::vector<Uint8>& pixels,
+                                    const Vector2u& size, const Image::EncodingSettings& settings)
 {
-    // Open the file to write in
-    FILE* file = fopen(filename.c_str(), "wb");
-    if (!file)
-        return false;
+    // Make sure the image is not empty
+    if (!pixels.empty() && (size.x > 0) && (size.y > 0))
+    {
+        std::string specified = getFormat(format);
 
+        if (specified == "png")
+        {
+            // PNG format
+            if (encodePng(&pixels[0], size.x, size.y, settings.compressionLevel, settings.threadCount, output))
+                return true;
+        }
+        else if (specified == "jpg")
+        {
+            // JPG format
+            if (writeJpg(output, pixels, size.x, size.y, settings.quality))
+                return true;
+        }
+    }
+
+    err() << "Failed to save image with format \"" << format << "\"" << std::endl;
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ImageLoader::writeJpg(std::vector<Uint8>& output, const std::vector<Uint8>& pixels, unsigned int width, unsigned int height, int quality)
+{
     // Initialize the error handler
     jpeg_compress_struct compressInfos;
     jpeg_error_mgr errorManager;
@@ -283,27 +355,34 @@ bool ImageLoader::writeJpg(const std::string& filename, const std::vector<Uint8>
     compressInfos.image_height     = height;
     compressInfos.input_components = 3;
     compressInfos.in_color_space   = JCS_RGB;
-    jpeg_stdio_dest(&compressInfos, file);
     jpeg_set_defaults(&compressInfos);
-    jpeg_set_quality(&compressInfos, 90, TRUE);
+    jpeg_set_quality(&compressInfos, quality, TRUE);
 
-    // Get rid of the alpha channel
-    std::vector<Uint8> buffer(width * height * 3);
-    for (std::size_t i = 0; i < width * height; ++i)
-    {
-        buffer[i * 3 + 0] = pixels[i * 4 + 0];
-        buffer[i * 3 + 1] = pixels[i * 4 + 1];
-        buffer[i * 3 + 2] = pixels[i * 4 + 2];
-    }
-    Uint8* ptr = &buffer[0];
+    // Write to the output buffer
+    output.clear();
+    JpegDestination destination;
+    destination.manager.init_destination    = &initDestination;
+    destination.manager.empty_output_buffer = &emptyOutputBuffer;
+    destination.manager.term_destination    = &termDestination;
+    destination.output                      = &output;
+    compressInfos.dest = &destination.manager;
 
     // Start compression
     jpeg_start_compress(&compressInfos, TRUE);
 
-    // Write each row of the image
+    // Write each row of the image, getting rid of the alpha channel on the fly
+    std::vector<Uint8> row(width * 3);
+    JSAMPROW rawPointer = &row[0];
     while (compressInfos.next_scanline < compressInfos.image_height)
     {
-        JSAMPROW rawPointer = ptr + (compressInfos.next_scanline * width * 3);
+        const Uint8* source = &pixels[compressInfos.next_scanline * width * 4];
+        for (unsigned int x = 0; x < width; ++x)
+        {
+            row[x * 3 + 0] = source[x * 4 + 0];
+            row[x * 3 + 1] = source[x * 4 + 1];
+            row[x * 3 + 2] = source[x * 4 + 2];
+        }
+
         jpeg_write_scanlines(&compressInfos, &rawPointer, 1);
     }
 
@@ -311,9 +390,6 @@ bool ImageLoader::writeJpg(const std::string& filename, const std::vector<Uint8>
     jpeg_finish_compress(&compressInfos);
     jpeg_destroy_compress(&compressInfos);
 
-    // Close the file
-    fclose(file);
-
     return true;
 }
 
@@ -28,6 +28,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/System/NonCopyable.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <string>
@@ -99,11 +100,28 @@ public:
     /// \param filename Path of image file to save
     /// \param pixels   Array of pixels to save to image
     /// \param size     Size of image to save, in pixels
+    /// \param settings Encoding settings
     ///
     /// \return True if saving was successful
     ///
     ////////////////////////////////////////////////////////////
-    bool saveImageToFile(const std::string& filename, const std::vector<Uint8>& pixels, const Vector2u& size);
+    bool saveImageToFile(const std::string& filename, const std::vector<Uint8>& pixels, const Vector2u& size,
+                         const Image::EncodingSettings& settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save an array of pixels as an encoded image buffer
+    ///
+    /// \param format   Must be "png" or "jpg"
+    /// \param output   Buffer to fill with encoded data
+    /// \param pixels   Array of pixels to save to image
+    /// \param size     Size of image to save, in pixels
+    /// \param settings Encoding settings
+    ///
+    /// \return True if saving was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool saveImageToMemory(const std::string& format, std::vector<Uint8>& output, const std::vector<Uint8>& pixels,
+                           const Vector2u& size, const Image::EncodingSettings& settings);
 
 private:
 
@@ -120,17 +138,18 @@ private:
     ~ImageLoader();
 
     ////////////////////////////////////////////////////////////
-    /// \brief Save an image file in JPEG format
+    /// \brief Encode an image in JPEG format
     ///
-    /// \param filename Path of image file to save
-    /// \param pixels   Array of pixels to save to image
-    /// \param width    Width of image to save, in pixels
-    /// \param height   Height of image to save, in pixels
+    /// \param output  Buffer to fill with encoded data
+    /// \param pixels  Array of pixels to save to image
+    /// \param width   Width of image to save, in pixels
+    /// \param height  Height of image to save, in pixels
+    /// \param quality Quality of the compression, from 1 to 100
     ///
     /// \return True if saving was successful
     ///
     ////////////////////////////////////////////////////////////
-    bool writeJpg(const std::string& filename, const std::vector<Uint8>& pixels, unsigned int width, unsigned int height);
+    bool writeJpg(std::vector<Uint8>& output, const std::vector<Uint8>& pixels, unsigned int width, unsigned int height, int quality);
 };
 
 } // namespace priv
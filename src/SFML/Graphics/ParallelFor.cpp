@@ -0,0 +1,280 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ParallelFor.hpp>
+#include <SFML/System/Thread.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <deque>
+#if defined(SFML_SYSTEM_WINDOWS)
+    #include <windows.h>
+    #include <climits>
+#else
+    #include <pthread.h>
+#endif
+
+
+namespace
+{
+    // Counting semaphore, which sf::Mutex alone can't emulate:
+    // threads must be able to sleep until another one wakes them up
+    class Semaphore : sf::NonCopyable
+    {
+    public:
+
+        Semaphore()
+        {
+        #if defined(SFML_SYSTEM_WINDOWS)
+            m_semaphore = CreateSemaphore(NULL, 0, LONG_MAX, NULL);
+        #else
+            m_count = 0;
+            pthread_mutex_init(&m_mutex, NULL);
+            pthread_cond_init(&m_condition, NULL);
+        #endif
+        }
+
+        ~Semaphore()
+        {
+        #if defined(SFML_SYSTEM_WINDOWS)
+            CloseHandle(m_semaphore);
+        #else
+            pthread_cond_destroy(&m_condition);
+            pthread_mutex_destroy(&m_mutex);
+        #endif
+        }
+
+        // Wake up to count waiting threads
+        void post(std::size_t count = 1)
+        {
+            if (count == 0)
+                return;
+
+        #if defined(SFML_SYSTEM_WINDOWS)
+            ReleaseSemaphore(m_semaphore, static_cast<LONG>(count), NULL);
+        #else
+            pthread_mutex_lock(&m_mutex);
+            m_count += count;
+            if (count == 1)
+                pthread_cond_signal(&m_condition);
+            else
+                pthread_cond_broadcast(&m_condition);
+            pthread_mutex_unlock(&m_mutex);
+        #endif
+        }
+
+        // Sleep until the semaphore is posted
+        void wait()
+        {
+        #if defined(SFML_SYSTEM_WINDOWS)
+            WaitForSingleObject(m_semaphore, INFINITE);
+        #else
+            pthread_mutex_lock(&m_mutex);
+            while (m_count == 0)
+                pthread_cond_wait(&m_condition, &m_mutex);
+            --m_count;
+            pthread_mutex_unlock(&m_mutex);
+        #endif
+        }
+
+    private:
+
+    #if defined(SFML_SYSTEM_WINDOWS)
+        HANDLE          m_semaphore;
+    #else
+        pthread_mutex_t m_mutex;
+        pthread_cond_t  m_condition;
+        std::size_t     m_count;
+    #endif
+    };
+
+    // Parts of a parallelFor call which are not finished yet
+    struct Job
+    {
+        Semaphore   done;    // Posted by the worker which finishes the last part
+        std::size_t pending; // Number of parts not finished yet
+    };
+
+    // Part of a job waiting for a thread
+    struct Item
+    {
+        sf::priv::ParallelFunction function;
+        void*                      data;
+        std::size_t                index;
+        Job*                       job;
+    };
+
+    // Persistent worker threads, shared by all the parallel jobs
+    class WorkerPool : sf::NonCopyable
+    {
+    public:
+
+        WorkerPool() :
+        m_stop(false)
+        {
+        }
+
+        ~WorkerPool()
+        {
+            {
+                sf::Lock lock(m_mutex);
+                m_stop = true;
+            }
+
+            // Destroying a thread waits for it to finish
+            m_work.post(m_workers.size());
+            for (std::vector<sf::Thread*>::iterator it = m_workers.begin(); it != m_workers.end(); ++it)
+                delete *it;
+        }
+
+        void run(std::size_t count, sf::priv::ParallelFunction function, void* data)
+        {
+            if (count == 0)
+                return;
+
+            if (count == 1)
+            {
+                function(data, 0);
+                return;
+            }
+
+            Job job;
+            job.pending = count;
+
+            // Queue all the parts but the first one, and make sure that there are enough workers to take them
+            {
+                sf::Lock lock(m_mutex);
+
+                for (std::size_t i = 1; i < count; ++i)
+                {
+                    Item item = {function, data, i, &job};
+                    m_items.push_back(item);
+                }
+
+                while (m_workers.size() < count - 1)
+                {
+                    sf::Thread* worker = new sf::Thread(&WorkerPool::work, this);
+                    worker->launch();
+                    m_workers.push_back(worker);
+                }
+            }
+            m_work.post(count - 1);
+
+            // Process the first part, then help with the parts that are still queued
+            function(data, 0);
+            bool finished = finish(job);
+
+            Item item;
+            while (!finished && takeItem(job, item))
+            {
+                item.function(item.data, item.index);
+                finished = finish(job);
+            }
+
+            // Wait for the workers to finish the remaining parts
+            if (!finished)
+                job.done.wait();
+        }
+
+    private:
+
+        // Mark a part of a job as finished, return true if it was the last one
+        bool finish(Job& job)
+        {
+            sf::Lock lock(m_mutex);
+
+            return --job.pending == 0;
+        }
+
+        // Take back a queued part of a job; parts are queued together,
+        // so they are at the end of the queue unless another job came after
+        bool takeItem(const Job& job, Item& item)
+        {
+            sf::Lock lock(m_mutex);
+
+            if (m_items.empty() || (m_items.back().job != &job))
+                return false;
+
+            item = m_items.back();
+            m_items.pop_back();
+
+            return true;
+        }
+
+        // Entry point of the worker threads
+        void work()
+        {
+            for (;;)
+            {
+                m_work.wait();
+
+                // The queue may be empty if the caller took back the item
+                Item item;
+                {
+                    sf::Lock lock(m_mutex);
+
+                    if (m_stop)
+                        return;
+
+                    if (m_items.empty())
+                        continue;
+
+                    item = m_items.front();
+                    m_items.pop_front();
+                }
+
+                item.function(item.data, item.index);
+
+                if (finish(*item.job))
+                    item.job->done.post();
+            }
+        }
+
+        sf::Mutex                 m_mutex;   // Protects the queue, the workers and the pending counts
+        Semaphore                 m_work;    // Posted once for each queued item
+        std::deque<Item>          m_items;   // Parts waiting for a thread
+        std::vector<sf::Thread*>  m_workers; // Worker threads
+        bool                      m_stop;    // Should the workers finish?
+    };
+
+    WorkerPool pool;
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+void parallelFor(std::size_t count, ParallelFunction function, void* data)
+{
+    pool.run(count, function, data);
+}
+
+} // namespace priv
+
+} // namespace sf
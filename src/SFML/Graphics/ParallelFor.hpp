@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_PARALLELFOR_HPP
+#define SFML_PARALLELFOR_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+#include <cstddef>
+#include <vector>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Type of the functions run by parallelFor
+///
+/// \param data  User data passed to parallelFor
+/// \param index Index of the part to process
+///
+////////////////////////////////////////////////////////////
+typedef void (*ParallelFunction)(void* data, std::size_t index);
+
+////////////////////////////////////////////////////////////
+/// \brief Run a function for each part of a job, in parallel
+///
+/// The first part runs in the calling thread, the other ones
+/// are dispatched to a pool of worker threads which are
+/// created the first time they are needed and then kept
+/// alive, so that calling this function every frame is cheap.
+/// The calling thread also processes the parts that no worker
+/// has picked up yet, and the function returns when all of
+/// them are finished.
+///
+/// \param count    Number of parts
+/// \param function Function to call for each part
+/// \param data     User data to pass to the function
+///
+////////////////////////////////////////////////////////////
+void parallelFor(std::size_t count, ParallelFunction function, void* data);
+
+////////////////////////////////////////////////////////////
+/// \brief Call the run() function of a task (used by parallelFor)
+///
+////////////////////////////////////////////////////////////
+template <typename T>
+void runParallelTask(void* tasks, std::size_t index)
+{
+    static_cast<T*>(tasks)[index].run();
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Call the run() function of each task, in parallel
+///
+/// \param tasks Tasks to run, one per thread
+///
+////////////////////////////////////////////////////////////
+template <typename T>
+void parallelFor(std::vector<T>& tasks)
+{
+    if (!tasks.empty())
+        parallelFor(tasks.size(), &runParallelTask<T>, &tasks[0]);
+}
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_PARALLELFOR_HPP
@@ -0,0 +1,302 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ParticleSystem.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/ParallelFor.hpp>
+#include <algorithm>
+#include <cstdlib>
+
+
+namespace
+{
+    // Minimum number of particles that justifies an additional thread
+    const std::size_t minParticlesPerThread = 8192;
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Portion of the particles updated by a thread
+///
+////////////////////////////////////////////////////////////
+struct ParticleSystem::UpdateTask
+{
+    void run()
+    {
+        system->updateRange(begin, end, dt);
+    }
+
+    ParticleSystem* system;
+    std::size_t     begin;
+    std::size_t     end;
+    float           dt;
+};
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem::ParticleSystem() :
+m_texture     (NULL),
+m_acceleration(0, 0),
+m_threadCount (1),
+m_positionsX  (),
+m_positionsY  (),
+m_velocitiesX (),
+m_velocitiesY (),
+m_lifetimes   (),
+m_colors      (),
+m_textureRects(),
+m_vertices    ()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setTexture(const Texture* texture)
+{
+    m_texture = texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* ParticleSystem::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setAcceleration(const Vector2f& acceleration)
+{
+    m_acceleration = acceleration;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f& ParticleSystem::getAcceleration() const
+{
+    return m_acceleration;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setThreadCount(unsigned int count)
+{
+    m_threadCount = std::max(count, 1u);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ParticleSystem::getThreadCount() const
+{
+    return m_threadCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::emit(const Vector2f& position, const Vector2f& velocity, Time lifetime, const IntRect& textureRect, const Color& color)
+{
+    m_positionsX.push_back(position.x);
+    m_positionsY.push_back(position.y);
+    m_velocitiesX.push_back(velocity.x);
+    m_velocitiesY.push_back(velocity.y);
+    m_lifetimes.push_back(lifetime.asSeconds());
+    m_colors.push_back(color);
+    m_textureRects.push_back(textureRect);
+
+    // Make the particle visible right away, even before the next update
+    std::size_t index = m_positionsX.size() - 1;
+    m_vertices.resize(m_positionsX.size() * 6);
+    updateVertices(index, index + 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::update(Time elapsed)
+{
+    float dt = elapsed.asSeconds();
+
+    // Remove the particles whose lifetime is over
+    for (std::size_t i = 0; i < m_lifetimes.size();)
+    {
+        if (m_lifetimes[i] <= dt)
+            remove(i);
+        else
+            ++i;
+    }
+
+    std::size_t count = m_positionsX.size();
+    m_vertices.resize(count * 6);
+
+    // Decide how many threads are worth using
+    std::size_t threadCount = std::min<std::size_t>(m_threadCount, count / minParticlesPerThread);
+    if (threadCount <= 1)
+    {
+        updateRange(0, count, dt);
+        return;
+    }
+
+    // Split the particles into contiguous ranges of the same size
+    std::vector<UpdateTask> tasks(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+    {
+        tasks[i].system = this;
+        tasks[i].begin  = count * i / threadCount;
+        tasks[i].end    = count * (i + 1) / threadCount;
+        tasks[i].dt     = dt;
+    }
+
+    // Update the ranges in parallel, the first one in this thread
+    priv::parallelFor(tasks);
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::clear()
+{
+    m_positionsX.clear();
+    m_positionsY.clear();
+    m_velocitiesX.clear();
+    m_velocitiesY.clear();
+    m_lifetimes.clear();
+    m_colors.clear();
+    m_textureRects.clear();
+    m_vertices.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getParticleCount() const
+{
+    return m_positionsX.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::draw(RenderTarget& target, RenderStates states) const
+{
+    if (!m_vertices.empty())
+    {
+        states.transform *= getTransform();
+        states.texture = m_texture;
+        target.draw(&m_vertices[0], m_vertices.size(), Triangles, states);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::updateRange(std::size_t begin, std::size_t end, float dt)
+{
+    if (begin >= end)
+        return;
+
+    // Work on raw arrays, so that the loops are simple enough to be vectorized
+    float* x         = &m_positionsX[0];
+    float* y         = &m_positionsY[0];
+    float* vx        = &m_velocitiesX[0];
+    float* vy        = &m_velocitiesY[0];
+    float* lifetimes = &m_lifetimes[0];
+    float  ax        = m_acceleration.x * dt;
+    float  ay        = m_acceleration.y * dt;
+
+    for (std::size_t i = begin; i < end; ++i)
+        lifetimes[i] -= dt;
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        vx[i] += ax;
+        x[i]  += vx[i] * dt;
+    }
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        vy[i] += ay;
+        y[i]  += vy[i] * dt;
+    }
+
+    updateVertices(begin, end);
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::updateVertices(std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const IntRect& rect  = m_textureRects[i];
+        const Color&   color = m_colors[i];
+
+        // Quad centered on the position of the particle
+        float halfWidth  = static_cast<float>(std::abs(rect.width)) / 2.f;
+        float halfHeight = static_cast<float>(std::abs(rect.height)) / 2.f;
+        float left       = m_positionsX[i] - halfWidth;
+        float top        = m_positionsY[i] - halfHeight;
+        float right      = m_positionsX[i] + halfWidth;
+        float bottom     = m_positionsY[i] + halfHeight;
+
+        float texLeft   = static_cast<float>(rect.left);
+        float texRight  = texLeft + rect.width;
+        float texTop    = static_cast<float>(rect.top);
+        float texBottom = texTop + rect.height;
+
+        // Two triangles per particle
+        Vertex* vertices = &m_vertices[i * 6];
+        vertices[0] = Vertex(Vector2f(left, top),     color, Vector2f(texLeft, texTop));
+        vertices[1] = Vertex(Vector2f(right, top),    color, Vector2f(texRight, texTop));
+        vertices[2] = Vertex(Vector2f(left, bottom),  color, Vector2f(texLeft, texBottom));
+        vertices[3] = vertices[2];
+        vertices[4] = vertices[1];
+        vertices[5] = Vertex(Vector2f(right, bottom), color, Vector2f(texRight, texBottom));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::remove(std::size_t index)
+{
+    std::size_t last = m_positionsX.size() - 1;
+
+    m_positionsX[index]   = m_positionsX[last];
+    m_positionsY[index]   = m_positionsY[last];
+    m_velocitiesX[index]  = m_velocitiesX[last];
+    m_velocitiesY[index]  = m_velocitiesY[last];
+    m_lifetimes[index]    = m_lifetimes[last];
+    m_colors[index]       = m_colors[last];
+    m_textureRects[index] = m_textureRects[last];
+
+    m_positionsX.pop_back();
+    m_positionsY.pop_back();
+    m_velocitiesX.pop_back();
+    m_velocitiesY.pop_back();
+    m_lifetimes.pop_back();
+    m_colors.pop_back();
+    m_textureRects.pop_back();
+}
+
+} // namespace sf
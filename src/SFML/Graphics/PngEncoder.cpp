@@ -0,0 +1,639 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/PngEncoder.hpp>
+#include <SFML/Graphics/ParallelFor.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+
+namespace
+{
+    // Minimum number of rows that justifies an additional thread
+    const unsigned int minRowsPerThread = 16;
+
+    // Maximum size of the data of an IDAT chunk (PNG limits chunks to 2^31 - 1 bytes)
+    const std::size_t maxChunkSize = 1 << 20;
+
+    // Deflate parameters
+    const std::size_t windowSize = 32768;
+    const unsigned int hashBits  = 15;
+    const std::size_t hashSize   = 1 << hashBits;
+    const std::size_t minMatch   = 3;
+    const std::size_t maxMatch   = 258;
+
+    // Search parameters of each compression level (same trade-offs as zlib):
+    // hash chain entries visited, length which stops the search, length below
+    // which a longer match is looked for at the next position (0 = greedy)
+    struct LevelParameters
+    {
+        unsigned int chainLength;
+        std::size_t  niceLength;
+        std::size_t  lazyLength;
+    };
+    const LevelParameters levelParameters[10] =
+    {
+        {0,    0,   0},
+        {4,    8,   0},
+        {8,    16,  0},
+        {32,   32,  0},
+        {16,   16,  4},
+        {32,   32,  16},
+        {128,  128, 16},
+        {256,  128, 32},
+        {1024, 258, 128},
+        {4096, 258, 258}
+    };
+
+    // Length and distance codes of the deflate format
+    const unsigned short lengthBase[29]    = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    const unsigned char  lengthExtra[29]   = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    const unsigned short distanceBase[30]  = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+    const unsigned char  distanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+    // CRC-32 lookup table, built once at startup
+    struct CrcTable
+    {
+        CrcTable()
+        {
+            for (sf::Uint32 i = 0; i < 256; ++i)
+            {
+                sf::Uint32 value = i;
+                for (int j = 0; j < 8; ++j)
+                    value = (value & 1) ? (value >> 1) ^ 0xEDB88320 : (value >> 1);
+                values[i] = value;
+            }
+        }
+
+        sf::Uint32 values[256];
+    };
+    const CrcTable crcTable;
+
+    // Compute the CRC-32 of a block of data
+    sf::Uint32 crc32(const sf::Uint8* data, std::size_t size)
+    {
+        sf::Uint32 crc = 0xFFFFFFFF;
+        for (std::size_t i = 0; i < size; ++i)
+            crc = crcTable.values[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        return crc ^ 0xFFFFFFFF;
+    }
+
+    // Compute the Adler-32 checksum of a block of data
+    sf::Uint32 adler32(const sf::Uint8* data, std::size_t size)
+    {
+        sf::Uint32 s1 = 1;
+        sf::Uint32 s2 = 0;
+        while (size > 0)
+        {
+            // 5552 is the largest block which cannot overflow s2 before the modulo
+            std::size_t count = std::min<std::size_t>(size, 5552);
+            size -= count;
+            while (count--)
+            {
+                s1 += *data++;
+                s2 += s1;
+            }
+            s1 %= 65521;
+            s2 %= 65521;
+        }
+
+        return (s2 << 16) | s1;
+    }
+
+    // Combine the Adler-32 checksums of two consecutive blocks
+    sf::Uint32 combineAdler32(sf::Uint32 first, sf::Uint32 second, std::size_t secondSize)
+    {
+        const sf::Uint32 base = 65521;
+
+        sf::Uint32 remainder = static_cast<sf::Uint32>(secondSize % base);
+        sf::Uint32 s1 = first & 0xFFFF;
+        sf::Uint32 s2 = (remainder * s1) % base;
+        s1 += (second & 0xFFFF) + base - 1;
+        s2 += (first >> 16) + (second >> 16) + base - remainder;
+        if (s1 >= base) s1 -= base;
+        if (s1 >= base) s1 -= base;
+        if (s2 >= base * 2) s2 -= base * 2;
+        if (s2 >= base) s2 -= base;
+
+        return (s2 << 16) | s1;
+    }
+
+    // Stream of bits, written least significant first as deflate expects
+    struct BitStream
+    {
+        explicit BitStream(std::vector<sf::Uint8>& buffer) :
+        output(buffer),
+        bits  (0),
+        count (0)
+        {
+        }
+
+        void write(sf::Uint32 value, unsigned int length)
+        {
+            bits |= value << count;
+            count += length;
+            while (count >= 8)
+            {
+                output.push_back(static_cast<sf::Uint8>(bits));
+                bits >>= 8;
+                count -= 8;
+            }
+        }
+
+        void writeCode(sf::Uint32 code, unsigned int length)
+        {
+            // Huffman codes are stored most significant bit first
+            sf::Uint32 reversed = 0;
+            for (unsigned int i = 0; i < length; ++i)
+                reversed |= ((code >> i) & 1) << (length - 1 - i);
+            write(reversed, length);
+        }
+
+        void align()
+        {
+            if (count > 0)
+                output.push_back(static_cast<sf::Uint8>(bits));
+            bits  = 0;
+            count = 0;
+        }
+
+        std::vector<sf::Uint8>& output;
+        sf::Uint32              bits;
+        unsigned int            count;
+    };
+
+    // Write a literal/length symbol with the fixed Huffman code
+    void writeSymbol(BitStream& stream, unsigned int symbol)
+    {
+        if (symbol <= 143)
+            stream.writeCode(0x30 + symbol, 8);
+        else if (symbol <= 255)
+            stream.writeCode(0x190 + symbol - 144, 9);
+        else if (symbol <= 279)
+            stream.writeCode(symbol - 256, 7);
+        else
+            stream.writeCode(0xC0 + symbol - 280, 8);
+    }
+
+    // Write a back-reference
+    void writeMatch(BitStream& stream, std::size_t length, std::size_t distance)
+    {
+        unsigned int code = static_cast<unsigned int>(std::upper_bound(lengthBase, lengthBase + 29, length) - lengthBase) - 1;
+        writeSymbol(stream, 257 + code);
+        stream.write(static_cast<sf::Uint32>(length - lengthBase[code]), lengthExtra[code]);
+
+        code = static_cast<unsigned int>(std::upper_bound(distanceBase, distanceBase + 30, distance) - distanceBase) - 1;
+        stream.writeCode(code, 5);
+        stream.write(static_cast<sf::Uint32>(distance - distanceBase[code]), distanceExtra[code]);
+    }
+
+    // Hash the 3 bytes starting at the given position
+    std::size_t hash(const sf::Uint8* data)
+    {
+        sf::Uint32 value = data[0] | (data[1] << 8) | (data[2] << 16);
+        return (value * 2654435761u) >> (32 - hashBits);
+    }
+
+    // LZ77 dictionary, made of hash chains limited to the deflate window
+    struct Dictionary
+    {
+        Dictionary(const sf::Uint8* source, std::size_t sourceSize, const LevelParameters& levelParameters) :
+        data      (source),
+        size      (sourceSize),
+        parameters(levelParameters),
+        head      (hashSize, 0),
+        previous  (windowSize, 0)
+        {
+        }
+
+        // Positions are stored plus one, so that 0 means "none"
+        void insert(std::size_t position)
+        {
+            if (position + minMatch > size)
+                return;
+
+            std::size_t& first = head[hash(data + position)];
+            previous[position % windowSize] = first;
+            first = position + 1;
+        }
+
+        std::size_t findMatch(std::size_t position, std::size_t& distance) const
+        {
+            if (position + minMatch > size)
+                return 0;
+
+            std::size_t limit = std::min(maxMatch, size - position);
+            std::size_t nice = std::min(parameters.niceLength, limit);
+            std::size_t best = 0;
+            std::size_t candidate = head[hash(data + position)];
+            for (unsigned int i = 0; (i < parameters.chainLength) && (candidate > 0); ++i)
+            {
+                std::size_t start = candidate - 1;
+                if (position - start > windowSize)
+                    break;
+
+                // Quick rejection on the byte which would make the match longer, and the first one
+                if ((data[start + best] == data[position + best]) && (data[start] == data[position]))
+                {
+                    std::size_t length = 0;
+                    while ((length < limit) && (data[start + length] == data[position + length]))
+                        ++length;
+
+                    if (length > best)
+                    {
+                        best     = length;
+                        distance = position - start;
+                        if (best >= nice)
+                            break;
+                    }
+                }
+
+                std::size_t next = previous[start % windowSize];
+                if (next >= candidate)
+                    break;
+                candidate = next;
+            }
+
+            return best >= minMatch ? best : 0;
+        }
+
+        const sf::Uint8*         data;
+        std::size_t              size;
+        LevelParameters          parameters;
+        std::vector<std::size_t> head;
+        std::vector<std::size_t> previous;
+    };
+
+    // Write a block of data as stored (uncompressed) deflate blocks, which end on a byte boundary
+    void writeStored(const sf::Uint8* data, std::size_t size, bool last, std::vector<sf::Uint8>& output)
+    {
+        BitStream stream(output);
+
+        std::size_t offset = 0;
+        do
+        {
+            std::size_t count = std::min<std::size_t>(size - offset, 65535);
+            bool final = last && (offset + count == size);
+
+            stream.write(final ? 1 : 0, 1);
+            stream.write(0, 2);
+            stream.align();
+            output.push_back(static_cast<sf::Uint8>(count & 0xFF));
+            output.push_back(static_cast<sf::Uint8>(count >> 8));
+            output.push_back(static_cast<sf::Uint8>(~count & 0xFF));
+            output.push_back(static_cast<sf::Uint8>((~count >> 8) & 0xFF));
+            output.insert(output.end(), data + offset, data + offset + count);
+            offset += count;
+        }
+        while (offset < size);
+    }
+
+    // Deflate a block of data; unless it is the last one, end it on a byte
+    // boundary so that the next one can be appended directly
+    void deflate(const sf::Uint8* data, std::size_t size, int level, bool last, std::vector<sf::Uint8>& output)
+    {
+        if (level == 0)
+        {
+            writeStored(data, size, last, output);
+            return;
+        }
+
+        std::size_t start = output.size();
+        BitStream stream(output);
+
+        // Single block using the fixed Huffman codes
+        stream.write(last ? 1 : 0, 1);
+        stream.write(1, 2);
+
+        Dictionary dictionary(data, size, levelParameters[level]);
+        std::size_t lazyLength = levelParameters[level].lazyLength;
+
+        std::size_t position = 0;
+        std::size_t distance = 0;
+        std::size_t length = dictionary.findMatch(position, distance);
+        while (position < size)
+        {
+            dictionary.insert(position);
+
+            // If the next position starts a longer match, emit a literal and take it instead
+            if ((length > 0) && (length < lazyLength))
+            {
+                std::size_t nextDistance = 0;
+                std::size_t nextLength = dictionary.findMatch(position + 1, nextDistance);
+                if (nextLength > length)
+                {
+                    writeSymbol(stream, data[position]);
+                    ++position;
+                    length   = nextLength;
+                    distance = nextDistance;
+                    continue;
+                }
+            }
+
+            if (length > 0)
+            {
+                writeMatch(stream, length, distance);
+                for (std::size_t i = 1; i < length; ++i)
+                    dictionary.insert(position + i);
+                position += length;
+            }
+            else
+            {
+                writeSymbol(stream, data[position]);
+                ++position;
+            }
+
+            length = dictionary.findMatch(position, distance);
+        }
+
+        // End of block
+        writeSymbol(stream, 256);
+
+        if (!last)
+        {
+            // Empty stored block, which ends on a byte boundary
+            stream.write(0, 3);
+            stream.align();
+            output.push_back(0x00);
+            output.push_back(0x00);
+            output.push_back(0xFF);
+            output.push_back(0xFF);
+        }
+        else
+        {
+            stream.align();
+        }
+
+        // Data which doesn't compress (noise, already compressed pictures) is better stored as is;
+        // each stored block has a header of 5 bytes
+        std::size_t storedSize = size + 5 * std::max<std::size_t>((size + 65534) / 65535, 1);
+        if (output.size() - start > storedSize)
+        {
+            output.resize(start);
+            writeStored(data, size, last, output);
+        }
+    }
+
+    // Paeth predictor of the PNG format
+    sf::Uint8 paeth(int a, int b, int c)
+    {
+        int p  = a + b - c;
+        int pa = std::abs(p - a);
+        int pb = std::abs(p - b);
+        int pc = std::abs(p - c);
+
+        if ((pa <= pb) && (pa <= pc))
+            return static_cast<sf::Uint8>(a);
+        else if (pb <= pc)
+            return static_cast<sf::Uint8>(b);
+        else
+            return static_cast<sf::Uint8>(c);
+    }
+
+    // Filter a row with the predictor which gives the smallest residuals
+    void filterRow(const sf::Uint8* row, const sf::Uint8* above, std::size_t rowSize, int level,
+                   sf::Uint8* candidates, sf::Uint8* output)
+    {
+        const std::size_t bpp = 4;
+
+        // Without compression, filtering is a waste of time
+        if (level == 0)
+        {
+            output[0] = 0;
+            std::memcpy(output + 1, row, rowSize);
+            return;
+        }
+
+        sf::Uint8* none    = candidates;
+        sf::Uint8* sub     = candidates + rowSize;
+        sf::Uint8* up      = candidates + rowSize * 2;
+        sf::Uint8* average = candidates + rowSize * 3;
+        sf::Uint8* predict = candidates + rowSize * 4;
+
+        unsigned long scores[5] = {0, 0, 0, 0, 0};
+        for (std::size_t i = 0; i < rowSize; ++i)
+        {
+            int x = row[i];
+            int a = (i >= bpp) ? row[i - bpp] : 0;
+            int b = above ? above[i] : 0;
+            int c = (above && (i >= bpp)) ? above[i - bpp] : 0;
+
+            none[i]    = static_cast<sf::Uint8>(x);
+            sub[i]     = static_cast<sf::Uint8>(x - a);
+            up[i]      = static_cast<sf::Uint8>(x - b);
+            average[i] = static_cast<sf::Uint8>(x - ((a + b) >> 1));
+            predict[i] = static_cast<sf::Uint8>(x - paeth(a, b, c));
+
+            // Residuals are scored as signed values, small magnitudes compress best
+            for (int j = 0; j < 5; ++j)
+                scores[j] += std::abs(static_cast<int>(static_cast<signed char>(candidates[rowSize * j + i])));
+        }
+
+        int best = static_cast<int>(std::min_element(scores, scores + 5) - scores);
+        output[0] = static_cast<sf::Uint8>(best);
+        std::memcpy(output + 1, candidates + rowSize * best, rowSize);
+    }
+
+    // Band of rows filtered and compressed by a thread
+    struct EncodeTask
+    {
+        void run()
+        {
+            std::size_t rowSize = static_cast<std::size_t>(width) * 4;
+
+            std::vector<sf::Uint8> filtered((rowSize + 1) * (bottom - top));
+            std::vector<sf::Uint8> candidates(rowSize * 5);
+            for (unsigned int y = top; y < bottom; ++y)
+            {
+                const sf::Uint8* row   = pixels + rowSize * y;
+                const sf::Uint8* above = (y > 0) ? row - rowSize : NULL;
+                filterRow(row, above, rowSize, level, &candidates[0], &filtered[(rowSize + 1) * (y - top)]);
+            }
+
+            size  = filtered.size();
+            adler = adler32(&filtered[0], size);
+            compressed.reserve(size / 2);
+            deflate(&filtered[0], size, level, last, compressed);
+        }
+
+        const sf::Uint8*       pixels;
+        unsigned int           width;
+        unsigned int           top;
+        unsigned int           bottom;
+        int                    level;
+        bool                   last;
+        std::vector<sf::Uint8> compressed;
+        sf::Uint32             adler;
+        std::size_t            size;
+    };
+
+    // Append a 32-bits big endian integer
+    void writeUint32(std::vector<sf::Uint8>& output, sf::Uint32 value)
+    {
+        output.push_back(static_cast<sf::Uint8>(value >> 24));
+        output.push_back(static_cast<sf::Uint8>(value >> 16));
+        output.push_back(static_cast<sf::Uint8>(value >> 8));
+        output.push_back(static_cast<sf::Uint8>(value));
+    }
+
+    // Start a PNG chunk, and return where its CRC starts
+    std::size_t beginChunk(std::vector<sf::Uint8>& output, std::size_t length, const char* type)
+    {
+        writeUint32(output, static_cast<sf::Uint32>(length));
+        std::size_t start = output.size();
+        output.insert(output.end(), type, type + 4);
+        return start;
+    }
+
+    // Finish a PNG chunk with its CRC
+    void endChunk(std::vector<sf::Uint8>& output, std::size_t start)
+    {
+        writeUint32(output, crc32(&output[start], output.size() - start));
+    }
+
+    // Writer which splits the zlib stream into IDAT chunks of at most maxChunkSize bytes
+    struct DataChunks
+    {
+        DataChunks(std::vector<sf::Uint8>& output, std::size_t size) :
+        output   (output),
+        remaining(size),
+        left     (0),
+        start    (0)
+        {
+        }
+
+        void write(const sf::Uint8* data, std::size_t size)
+        {
+            while (size > 0)
+            {
+                // Start a new chunk when the current one is full
+                if (left == 0)
+                {
+                    left  = std::min(remaining, maxChunkSize);
+                    start = beginChunk(output, left, "IDAT");
+                }
+
+                std::size_t length = std::min(size, left);
+                output.insert(output.end(), data, data + length);
+                data      += length;
+                size      -= length;
+                left      -= length;
+                remaining -= length;
+
+                if (left == 0)
+                    endChunk(output, start);
+            }
+        }
+
+        std::vector<sf::Uint8>& output;
+        std::size_t             remaining;
+        std::size_t             left;
+        std::size_t             start;
+    };
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+bool encodePng(const Uint8* pixels, unsigned int width, unsigned int height, int compressionLevel,
+               unsigned int threadCount, std::vector<Uint8>& output)
+{
+    if (!pixels || (width == 0) || (height == 0))
+        return false;
+
+    int level = std::min(std::max(compressionLevel, 0), 9);
+
+    // Split the image into bands of rows, if it's worth it
+    unsigned int count = std::min(std::max(threadCount, 1u), std::max(height / minRowsPerThread, 1u));
+
+    std::vector<EncodeTask> tasks(count);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        tasks[i].pixels = pixels;
+        tasks[i].width  = width;
+        tasks[i].top    = static_cast<unsigned int>(static_cast<Uint64>(height) * i / count);
+        tasks[i].bottom = static_cast<unsigned int>(static_cast<Uint64>(height) * (i + 1) / count);
+        tasks[i].level  = level;
+        tasks[i].last   = (i == count - 1);
+    }
+
+    // Encode the bands in parallel, the first one in this thread
+    priv::parallelFor(tasks);
+
+    // Compute the size of the zlib stream: header, bands, checksum
+    std::size_t dataSize = 2 + 4;
+    for (unsigned int i = 0; i < count; ++i)
+        dataSize += tasks[i].compressed.size();
+
+    output.clear();
+    output.reserve(8 + 25 + dataSize + 12 * ((dataSize + maxChunkSize - 1) / maxChunkSize) + 12);
+
+    // Signature
+    const Uint8 signature[] = {137, 80, 78, 71, 13, 10, 26, 10};
+    output.insert(output.end(), signature, signature + 8);
+
+    // Header: size, 8 bits per component, RGBA, default compression, filtering and interlacing
+    std::size_t start = beginChunk(output, 13, "IHDR");
+    writeUint32(output, width);
+    writeUint32(output, height);
+    output.push_back(8);
+    output.push_back(6);
+    output.push_back(0);
+    output.push_back(0);
+    output.push_back(0);
+    endChunk(output, start);
+
+    // Data: the compressed bands joined into a single zlib stream, split into chunks
+    DataChunks chunks(output, dataSize);
+    const Uint8 zlibHeader[] = {0x78, static_cast<Uint8>(level <= 1 ? 0x01 : (level <= 5 ? 0x5E : (level == 6 ? 0x9C : 0xDA)))};
+    chunks.write(zlibHeader, 2);
+    Uint32 adler = 1;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        if (!tasks[i].compressed.empty())
+            chunks.write(&tasks[i].compressed[0], tasks[i].compressed.size());
+        adler = combineAdler32(adler, tasks[i].adler, tasks[i].size);
+    }
+    const Uint8 checksum[] = {static_cast<Uint8>(adler >> 24), static_cast<Uint8>(adler >> 16),
+                              static_cast<Uint8>(adler >> 8),  static_cast<Uint8>(adler)};
+    chunks.write(checksum, 4);
+
+    // End
+    start = beginChunk(output, 0, "IEND");
+    endChunk(output, start);
+
+    return true;
+}
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_PNGENCODER_HPP
+#define SFML_PNGENCODER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+#include <vector>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Encode an array of RGBA pixels as a PNG file
+///
+/// The rows are split into as many bands as there are threads;
+/// each band is filtered and deflated independently, and the
+/// compressed bands are joined into a single zlib stream.
+///
+/// \param pixels           Array of pixels to encode
+/// \param width            Width of the image, in pixels
+/// \param height           Height of the image, in pixels
+/// \param compressionLevel Compression level, from 0 (none) to 9 (best)
+/// \param threadCount      Maximum number of threads to use
+/// \param output           Buffer to fill with the encoded file
+///
+/// \return True if encoding was successful
+///
+////////////////////////////////////////////////////////////
+bool encodePng(const Uint8* pixels, unsigned int width, unsigned int height, int compressionLevel,
+               unsigned int threadCount, std::vector<Uint8>& output);
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_PNGENCODER_HPP
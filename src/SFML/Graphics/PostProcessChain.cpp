@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/PostProcessChain.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/ResourceAccess.hpp>
+#include <SFML/System/Err.hpp>
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PostProcessChain::PostProcessChain() :
+m_passes(),
+m_pool  ()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+PostProcessChain::~PostProcessChain()
+{
+    for (std::vector<Pass>::iterator it = m_passes.begin(); it != m_passes.end(); ++it)
+        delete it->target;
+
+    for (std::vector<RenderTexture*>::iterator it = m_pool.begin(); it != m_pool.end(); ++it)
+        delete *it;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PostProcessChain::addPass(const Shader& shader, float scale)
+{
+    Pass pass;
+    pass.shader       = &shader;
+    pass.scale        = scale;
+    pass.target       = NULL;
+    pass.inputId      = 0;
+    pass.programId    = 0;
+    pass.parametersId = 0;
+    pass.texturesId   = 0;
+    m_passes.push_back(pass);
+
+    return m_passes.size() - 1;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PostProcessChain::getPassCount() const
+{
+    return m_passes.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void PostProcessChain::clear()
+{
+    for (std::vector<Pass>::iterator it = m_passes.begin(); it != m_passes.end(); ++it)
+    {
+        if (it->target)
+            releaseTarget(it->target);
+    }
+
+    m_passes.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void PostProcessChain::invalidate()
+{
+    for (std::vector<Pass>::iterator it = m_passes.begin(); it != m_passes.end(); ++it)
+        it->inputId = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& PostProcessChain::apply(const Texture& input)
+{
+    if (!Shader::isAvailable())
+    {
+        err() << "Failed to apply post-processing chain: your system doesn't support shaders" << std::endl;
+        return input;
+    }
+
+    const Texture* current = &input;
+    Vector2u inputSize = input.getSize();
+
+    for (std::vector<Pass>::iterator pass = m_passes.begin(); pass != m_passes.end(); ++pass)
+    {
+        // Compute the size of the output of the pass
+        Vector2u size(static_cast<unsigned int>(inputSize.x * pass->scale + 0.5f),
+                      static_cast<unsigned int>(inputSize.y * pass->scale + 0.5f));
+        size.x = std::max(size.x, 1u);
+        size.y = std::max(size.y, 1u);
+
+        // Replace the render-texture if the size changed (or if there's none yet)
+        if (!pass->target || (pass->target->getSize() != size))
+        {
+            if (pass->target)
+                releaseTarget(pass->target);
+
+            pass->target  = acquireTarget(size);
+            pass->inputId = 0;
+
+            // Give up and return the last valid output
+            if (!pass->target)
+                break;
+        }
+
+        // Skip the pass if nothing changed since its last execution
+        const Shader& shader = *pass->shader;
+        Uint64 inputId      = priv::ResourceAccess::getCacheId(*current);
+        Uint64 programId    = priv::ResourceAccess::getCacheId(shader);
+        Uint64 parametersId = priv::ResourceAccess::getParametersId(shader);
+        Uint64 texturesId   = priv::ResourceAccess::getTexturesId(shader);
+        if ((pass->inputId      != inputId)      ||
+            (pass->programId    != programId)    ||
+            (pass->parametersId != parametersId) ||
+            (pass->texturesId   != texturesId))
+        {
+            // Map the whole input onto the whole output
+            Vector2f outputSize(static_cast<float>(size.x), static_cast<float>(size.y));
+            Vector2f textureSize(static_cast<float>(current->getSize().x), static_cast<float>(current->getSize().y));
+            m_quad[0] = Vertex(Vector2f(0, 0), Vector2f(0, 0));
+            m_quad[1] = Vertex(Vector2f(outputSize.x, 0), Vector2f(textureSize.x, 0));
+            m_quad[2] = Vertex(Vector2f(0, outputSize.y), Vector2f(0, textureSize.y));
+            m_quad[3] = Vertex(outputSize, textureSize);
+
+            // The quad covers the whole target, no need to clear it first
+            RenderStates states(BlendNone);
+            states.shader  = &shader;
+            states.texture = current;
+            pass->target->draw(m_quad, 4, TrianglesStrip, states);
+            pass->target->display();
+
+            pass->inputId      = inputId;
+            pass->programId    = programId;
+            pass->parametersId = parametersId;
+            pass->texturesId   = texturesId;
+        }
+
+        current = &pass->target->getTexture();
+    }
+
+    // Don't keep more free render-textures than the chain could use at once
+    if (m_pool.size() > m_passes.size())
+    {
+        std::size_t count = m_pool.size() - m_passes.size();
+        for (std::size_t i = 0; i < count; ++i)
+            delete m_pool[i];
+
+        m_pool.erase(m_pool.begin(), m_pool.begin() + count);
+    }
+
+    return *current;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* PostProcessChain::acquireTarget(const Vector2u& size)
+{
+    // Reuse the most recently released render-texture of the right size
+    for (std::vector<RenderTexture*>::reverse_iterator it = m_pool.rbegin(); it != m_pool.rend(); ++it)
+    {
+        if ((*it)->getSize() == size)
+        {
+            RenderTexture* target = *it;
+            m_pool.erase(--it.base());
+            return target;
+        }
+    }
+
+    // None available: create a new one
+    RenderTexture* target = new RenderTexture;
+    if (!target->create(size.x, size.y))
+    {
+        err() << "Failed to create render-texture for post-processing pass (" << size.x << "x" << size.y << ")" << std::endl;
+        delete target;
+        return NULL;
+    }
+
+    // Passes which change the resolution need filtering
+    target->setSmooth(true);
+
+    return target;
+}
+
+
+////////////////////////////////////////////////////////////
+void PostProcessChain::releaseTarget(RenderTexture* target)
+{
+    m_pool.push_back(target);
+}
+
+} // namespace sf
@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/PrimitiveList.hpp>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+PrimitiveType appendPrimitives(std::vector<Vertex>& list, const Vertex* vertices, std::size_t vertexCount,
+                               PrimitiveType type, const Transform& transform)
+{
+    std::size_t first = list.size();
+    PrimitiveType listType = type;
+
+    switch (type)
+    {
+        case LinesStrip:
+        {
+            listType = Lines;
+            for (std::size_t i = 1; i < vertexCount; ++i)
+            {
+                list.push_back(vertices[i - 1]);
+                list.push_back(vertices[i]);
+            }
+            break;
+        }
+
+        case TrianglesStrip:
+        {
+            listType = Triangles;
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                list.push_back(vertices[i - 2]);
+                list.push_back(vertices[i - 1]);
+                list.push_back(vertices[i]);
+            }
+            break;
+        }
+
+        case TrianglesFan:
+        {
+            listType = Triangles;
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                list.push_back(vertices[0]);
+                list.push_back(vertices[i - 1]);
+                list.push_back(vertices[i]);
+            }
+            break;
+        }
+
+        default:
+        {
+            list.insert(list.end(), vertices, vertices + vertexCount);
+            break;
+        }
+    }
+
+    // Transform the new vertices in place
+    if (list.size() > first)
+        transform.transformVertices(&list[first], &list[first], list.size() - first);
+
+    return listType;
+}
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_PRIMITIVELIST_HPP
+#define SFML_PRIMITIVELIST_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Append transformed primitives to a list of vertices
+///
+/// Strips and fans are converted to the equivalent lists
+/// (Lines or Triangles), and the vertices are transformed,
+/// so that consecutive primitives which share the same states
+/// can be merged into a single draw call whatever their
+/// original type and transform.
+///
+/// \param list        List to append the vertices to
+/// \param vertices    Pointer to the vertices
+/// \param vertexCount Number of vertices in the array
+/// \param type        Type of primitives
+/// \param transform   Transform to apply to the vertices
+///
+/// \return Type of the appended primitives (never a strip or a fan)
+///
+////////////////////////////////////////////////////////////
+PrimitiveType appendPrimitives(std::vector<Vertex>& list, const Vertex* vertices, std::size_t vertexCount,
+                               PrimitiveType type, const Transform& transform);
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_PRIMITIVELIST_HPP
@@ -29,6 +29,19 @@
 #include <cmath>
 
 
+namespace
+{
+    // Unit square shared by all the rectangle shapes
+    const sf::Vector2f unitSquare[] =
+    {
+        sf::Vector2f(0, 0),
+        sf::Vector2f(1, 0),
+        sf::Vector2f(1, 1),
+        sf::Vector2f(0, 1)
+    };
+}
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -42,7 +55,7 @@ RectangleShape::RectangleShape(const Vector2f& size)
 void RectangleShape::setSize(const Vector2f& size)
 {
     m_size = size;
-    update();
+    update(unitSquare, 4, m_size);
 }
 
 
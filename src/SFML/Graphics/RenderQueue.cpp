@@ -0,0 +1,228 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderQueue.hpp>
+#include <SFML/Graphics/PrimitiveList.hpp>
+#include <algorithm>
+
+
+namespace
+{
+    // Compare the render states of two draws
+    template <typename T>
+    int compareStates(const T& left, const T& right)
+    {
+        if (left.shader != right.shader)
+            return left.shader < right.shader ? -1 : 1;
+        if (left.texture != right.texture)
+            return left.texture < right.texture ? -1 : 1;
+
+        const sf::BlendMode& a = left.blendMode;
+        const sf::BlendMode& b = right.blendMode;
+        if (a.colorSrcFactor != b.colorSrcFactor) return a.colorSrcFactor < b.colorSrcFactor ? -1 : 1;
+        if (a.colorDstFactor != b.colorDstFactor) return a.colorDstFactor < b.colorDstFactor ? -1 : 1;
+        if (a.colorEquation  != b.colorEquation)  return a.colorEquation  < b.colorEquation  ? -1 : 1;
+        if (a.alphaSrcFactor != b.alphaSrcFactor) return a.alphaSrcFactor < b.alphaSrcFactor ? -1 : 1;
+        if (a.alphaDstFactor != b.alphaDstFactor) return a.alphaDstFactor < b.alphaDstFactor ? -1 : 1;
+        if (a.alphaEquation  != b.alphaEquation)  return a.alphaEquation  < b.alphaEquation  ? -1 : 1;
+
+        return 0;
+    }
+
+    // Sorting predicate for the recorded draws
+    template <typename T>
+    bool isBefore(const T& left, const T& right)
+    {
+        if (left.layer != right.layer)
+            return left.layer < right.layer;
+
+        int states = compareStates(left, right);
+        if (states != 0)
+            return states < 0;
+
+        return left.type < right.type;
+    }
+
+    // Count the render states changes in a sequence of draws
+    template <typename T>
+    unsigned int countStateChanges(const std::vector<T>& commands)
+    {
+        unsigned int changes = 0;
+        for (std::size_t i = 1; i < commands.size(); ++i)
+        {
+            if (compareStates(commands[i - 1], commands[i]) != 0)
+                ++changes;
+        }
+
+        return changes;
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RenderQueue::RenderQueue() :
+m_size    (0, 0),
+m_layer   (0),
+m_commands(),
+m_vertices(),
+m_batch   ()
+{
+    m_statistics.commandCount      = 0;
+    m_statistics.drawCallCount     = 0;
+    m_statistics.stateChanges      = 0;
+    m_statistics.stateChangesSaved = 0;
+
+    initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+RenderQueue::RenderQueue(const Vector2u& size) :
+m_size    (size),
+m_layer   (0),
+m_commands(),
+m_vertices(),
+m_batch   ()
+{
+    m_statistics.commandCount      = 0;
+    m_statistics.drawCallCount     = 0;
+    m_statistics.stateChanges      = 0;
+    m_statistics.stateChangesSaved = 0;
+
+    initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::setSize(const Vector2u& size)
+{
+    m_size = size;
+
+    // Update the default view
+    initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u RenderQueue::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::setLayer(int layer)
+{
+    m_layer = layer;
+}
+
+
+////////////////////////////////////////////////////////////
+int RenderQueue::getLayer() const
+{
+    return m_layer;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::draw(const Vertex* vertices, std::size_t vertexCount,
+                       PrimitiveType type, const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0))
+        return;
+
+    Command command;
+    command.layer     = m_layer;
+    command.shader    = states.shader;
+    command.texture   = states.texture;
+    command.blendMode = states.blendMode;
+    command.first     = m_vertices.size();
+
+    // Transform the vertices now, and convert strips and fans to lists,
+    // so that the draw can be merged with other ones
+    command.type  = priv::appendPrimitives(m_vertices, vertices, vertexCount, type, states.transform);
+    command.count = m_vertices.size() - command.first;
+    if (command.count == 0)
+        return;
+
+    m_commands.push_back(command);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::submit(RenderTarget& target)
+{
+    m_statistics.commandCount  = static_cast<unsigned int>(m_commands.size());
+    m_statistics.drawCallCount = 0;
+
+    // Sort the draws, keeping the recording order of the equivalent ones
+    unsigned int unsortedChanges = countStateChanges(m_commands);
+    std::stable_sort(m_commands.begin(), m_commands.end(), isBefore<Command>);
+    m_statistics.stateChanges = countStateChanges(m_commands);
+    m_statistics.stateChangesSaved = unsortedChanges > m_statistics.stateChanges ? unsortedChanges - m_statistics.stateChanges : 0;
+
+    // Merge the consecutive draws that share the same states and primitive type
+    for (std::size_t i = 0; i < m_commands.size(); ++i)
+    {
+        const Command& command = m_commands[i];
+        const Vertex* vertices = &m_vertices[command.first];
+        m_batch.insert(m_batch.end(), vertices, vertices + command.count);
+
+        bool last = (i + 1 == m_commands.size());
+        if (last || (compareStates(command, m_commands[i + 1]) != 0) || (command.type != m_commands[i + 1].type))
+        {
+            // The vertices are already transformed
+            RenderStates states(command.blendMode, Transform::Identity, command.texture, command.shader);
+            target.draw(&m_batch[0], m_batch.size(), command.type, states);
+            m_batch.clear();
+            ++m_statistics.drawCallCount;
+        }
+    }
+
+    m_commands.clear();
+    m_vertices.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderQueue::Statistics& RenderQueue::getStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderQueue::activate(bool)
+{
+    return false;
+}
+
+} // namespace sf
@@ -30,13 +30,57 @@
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/ResourceAccess.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Window/Context.hpp>
+#include <SFML/Window/GlResource.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
 #include <SFML/System/Err.hpp>
+#include <cstring>
 #include <iostream>
+#include <map>
 
 
 namespace
 {
+    sf::Mutex mutex;
+
+    // Thread-safe unique identifier generator,
+    // is used to know which target last used a context
+    sf::Uint64 getUniqueId()
+    {
+        sf::Lock lock(mutex);
+
+        static sf::Uint64 id = 1; // start at 1, zero is "no target"
+
+        return id++;
+    }
+
+    // Last target that rendered in each context; the entries are erased only when their
+    // context is destroyed, so that targets can keep a pointer to the one of their context
+    typedef std::map<sf::Uint64, sf::Uint64> ContextRenderTargets;
+    ContextRenderTargets contextRenderTargets;
+
+    // Forget the last target of a context which has been destroyed
+    void releaseContext(sf::Uint64 contextId)
+    {
+        sf::Lock lock(mutex);
+
+        contextRenderTargets.erase(contextId);
+    }
+
+    // Render targets are not OpenGL resources themselves,
+    // this gives them access to the context destruction callbacks
+    struct ContextWatcher : sf::GlResource
+    {
+        static void watch()
+        {
+            registerContextDestroyCallback(&releaseContext);
+        }
+    };
+
+
     // Convert an sf::BlendMode::Factor constant to the corresponding OpenGL constant.
     sf::Uint32 factorToGlConstant(sf::BlendMode::Factor blendFactor)
     {
@@ -74,9 +118,14 @@ namespace sf
 RenderTarget::RenderTarget() :
 m_defaultView(),
 m_view       (),
-m_cache      ()
+m_cache      (),
+m_id         (getUniqueId())
 {
-    m_cache.glStatesSet = false;
+    m_cache.glStatesSet   = false;
+    m_cache.contextId     = 0;
+    m_cache.contextTarget = NULL;
+
+    ContextWatcher::watch();
 }
 
 
@@ -89,7 +138,7 @@ RenderTarget::~RenderTarget()
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(const Color& color)
 {
-    if (activate(true))
+    if (activateContext())
     {
         // Unbind texture to fix RenderTexture preventing clear
         applyTexture(NULL);
@@ -205,7 +254,7 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
         #define GL_QUADS 0
     #endif
 
-    if (activate(true))
+    if (activateContext())
     {
         // First set the persistent OpenGL states if it's the very first call
         if (!m_cache.glStatesSet)
@@ -216,13 +265,7 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
         if (useVertexCache)
         {
             // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                Vertex& vertex = m_cache.vertexCache[i];
-                vertex.position = states.transform * vertices[i].position;
-                vertex.color = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
-            }
+            states.transform.transformVertices(vertices, m_cache.vertexCache, vertexCount);
 
             // Since vertices are transformed, we must use an identity transform to render them
             if (!m_cache.useVertexCache)
@@ -248,7 +291,27 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
 
         // Apply the shader
         if (states.shader)
-            applyShader(states.shader);
+        {
+            if (priv::ResourceAccess::getCacheId(*states.shader) != m_cache.lastShaderId)
+            {
+                applyShader(states.shader);
+            }
+            else
+            {
+                // Same program: only rebind its textures if they changed, and upload the modified uniforms
+                Uint64 texturesId = priv::ResourceAccess::getTexturesId(*states.shader);
+                if (texturesId != m_cache.lastShaderTexturesId)
+                {
+                    priv::ResourceAccess::bindTextures(*states.shader);
+                    m_cache.lastShaderTexturesId = texturesId;
+                }
+                priv::ResourceAccess::uploadUniforms(*states.shader);
+            }
+        }
+        else if (m_cache.lastShaderId)
+        {
+            applyShader(NULL);
+        }
 
         // If we pre-transform the vertices, we must use our internal vertex cache
         if (useVertexCache)
@@ -277,10 +340,6 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
         // Draw the primitives
         glCheck(glDrawArrays(mode, 0, vertexCount));
 
-        // Unbind the shader, if any
-        if (states.shader)
-            applyShader(NULL);
-
         // Update the cache
         m_cache.useVertexCache = useVertexCache;
     }
@@ -290,7 +349,7 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
 ////////////////////////////////////////////////////////////
 void RenderTarget::pushGLStates()
 {
-    if (activate(true))
+    if (activateContext())
     {
         #ifdef SFML_DEBUG
             // make sure that the user didn't leave an unchecked OpenGL error
@@ -322,8 +381,12 @@ void RenderTarget::pushGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::popGLStates()
 {
-    if (activate(true))
+    if (activateContext())
     {
+        // The shader of the last draw call is still bound, don't leak it to the user code
+        if (m_cache.lastShaderId)
+            applyShader(NULL);
+
         glCheck(glMatrixMode(GL_PROJECTION));
         glCheck(glPopMatrix());
         glCheck(glMatrixMode(GL_MODELVIEW));
@@ -341,10 +404,10 @@ void RenderTarget::popGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::resetGLStates()
 {
-    // Check here to make sure a context change does not happen after activate(true)
+    // Check here to make sure a context change does not happen after activateContext()
     bool shaderAvailable = Shader::isAvailable();
 
-    if (activate(true))
+    if (activateContext())
     {
         // Make sure that extensions are initialized
         priv::ensureExtensionsInit();
@@ -375,6 +438,8 @@ void RenderTarget::resetGLStates()
         applyTexture(NULL);
         if (shaderAvailable)
             applyShader(NULL);
+        else
+            m_cache.lastShaderId = 0;
 
         m_cache.useVertexCache = false;
 
@@ -396,6 +461,33 @@ void RenderTarget::initialize()
 }
 
 
+////////////////////////////////////////////////////////////
+bool RenderTarget::activateContext()
+{
+    if (!activate(true))
+        return false;
+
+    // The entry of the context is only looked up when we move to another context; it
+    // is only modified by the thread where the context is active, so it needs no lock
+    Uint64 contextId = Context::getActiveContextId();
+    if (contextId != m_cache.contextId)
+    {
+        Lock lock(mutex);
+        m_cache.contextTarget = &contextRenderTargets[contextId];
+        m_cache.contextId     = contextId;
+    }
+
+    // Another target may have rendered in the same context since our last draw
+    if (*m_cache.contextTarget != m_id)
+    {
+        *m_cache.contextTarget = m_id;
+        m_cache.glStatesSet = false;
+    }
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyCurrentView()
 {
@@ -475,7 +567,23 @@ void RenderTarget::applyTransform(const Transform& transform)
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyTexture(const Texture* texture)
 {
-    Texture::bind(texture, Texture::Pixels);
+    if (Texture::bindTexture(texture))
+    {
+        // Textures with the same size and orientation share the same
+        // matrix, there's no need to load it again when switching
+        const float* matrix = texture->m_pixelsMatrix;
+        if (!m_cache.textureMatrixSet || (std::memcmp(matrix, m_cache.textureMatrix, sizeof(m_cache.textureMatrix)) != 0))
+        {
+            Texture::loadMatrix(matrix);
+            std::memcpy(m_cache.textureMatrix, matrix, sizeof(m_cache.textureMatrix));
+            m_cache.textureMatrixSet = true;
+        }
+    }
+    else
+    {
+        Texture::loadMatrix(NULL);
+        m_cache.textureMatrixSet = false;
+    }
 
     m_cache.lastTextureId = texture ? texture->m_cacheId : 0;
 }
@@ -485,6 +593,9 @@ void RenderTarget::applyTexture(const Texture* texture)
 void RenderTarget::applyShader(const Shader* shader)
 {
     Shader::bind(shader);
+
+    m_cache.lastShaderId = shader ? priv::ResourceAccess::getCacheId(*shader) : 0;
+    m_cache.lastShaderTexturesId = shader ? priv::ResourceAccess::getTexturesId(*shader) : 0;
 }
 
 } // namespace sf
@@ -493,6 +604,12 @@ void RenderTarget::applyShader(const Shader* shader)
 ////////////////////////////////////////////////////////////
 // Render states caching strategies
 //
+// * Context
+//   Render textures render in whatever context is active, so
+//   several targets may share the same OpenGL states. We keep
+//   track of the last target that rendered in each context,
+//   and set all the states again when it changes.
+//
 // * View
 //   If SetView was called since last draw, the projection
 //   matrix is updated. We don't need more, the view doesn't
@@ -519,10 +636,14 @@ void RenderTarget::applyShader(const Shader* shader)
 //   identifier system to ensure consistent caching.
 //
 // * Shader
-//   Shaders are very hard to optimize, because they have
-//   parameters that can be hard (if not impossible) to track,
-//   like matrices or textures. The only optimization that we
-//   do is that we avoid setting a null shader if there was
-//   already none for the previous draw.
+//   Like textures, shaders use their own unique identifier,
+//   which changes when the program is (re)compiled. The shader
+//   stays bound after a draw, and is only bound again when a
+//   different one is used. Texture variables are identified by
+//   the locations and the unique identifiers of the textures,
+//   so that they are rebound only if one of them changed.
+//   Values set with setParameter are written immediately into
+//   the program, those set with setUniform are tracked by the
+//   shader and uploaded on the next draw if they changed.
 //
 ////////////////////////////////////////////////////////////
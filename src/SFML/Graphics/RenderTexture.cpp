@@ -51,6 +51,16 @@ RenderTexture::~RenderTexture()
 ////////////////////////////////////////////////////////////
 bool RenderTexture::create(unsigned int width, unsigned int height, bool depthBuffer)
 {
+    return create(width, height, ContextSettings(depthBuffer ? 32 : 0));
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTexture::create(unsigned int width, unsigned int height, const ContextSettings& settings)
+{
+    // The texture is attached to a frame buffer, it must stay in the video memory
+    m_texture.m_isEvictable = false;
+
     // Create the texture
     if (!m_texture.create(width, height))
     {
@@ -75,7 +85,7 @@ bool RenderTexture::create(unsigned int width, unsigned int height, bool depthBu
     }
 
     // Initialize the render texture
-    if (!m_impl->create(width, height, m_texture.m_texture, depthBuffer))
+    if (!m_impl->create(width, height, m_texture.m_texture, settings))
         return false;
 
     // We can now initialize the render target part
@@ -85,6 +95,16 @@ bool RenderTexture::create(unsigned int width, unsigned int height, bool depthBu
 }
 
 
+////////////////////////////////////////////////////////////
+unsigned int RenderTexture::getMaximumAntialiasingLevel()
+{
+    if (priv::RenderTextureImplFBO::isAvailable())
+        return priv::RenderTextureImplFBO::getMaximumAntialiasingLevel();
+
+    return 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTexture::setSmooth(bool smooth)
 {
@@ -123,11 +143,13 @@ bool RenderTexture::setActive(bool active)
 ////////////////////////////////////////////////////////////
 void RenderTexture::display()
 {
-    // Update the target texture
-    if (setActive(true))
+    // Update the target texture; the implementation activates
+    // what it needs, so that we don't flag its contents as modified
+    if (m_impl)
     {
         m_impl->updateTexture(m_texture.m_texture);
-        m_texture.m_pixelsFlipped = true;
+        m_texture.setPixelsFlipped(true);
+        m_texture.markAsModified();
     }
 }
 
@@ -29,6 +29,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/System/NonCopyable.hpp>
+#include <SFML/Window/ContextSettings.hpp>
 
 
 namespace sf
@@ -52,15 +53,15 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Create the render texture implementation
     ///
-    /// \param width       Width of the texture to render to
-    /// \param height      Height of the texture to render to
-    /// \param textureId   OpenGL identifier of the target texture
-    /// \param depthBuffer Is a depth buffer requested?
+    /// \param width     Width of the texture to render to
+    /// \param height    Height of the texture to render to
+    /// \param textureId OpenGL identifier of the target texture
+    /// \param settings  Settings of the buffers to create
     ///
     /// \return True if creation has been successful
     ///
     ////////////////////////////////////////////////////////////
-    virtual bool create(unsigned int width, unsigned int height, unsigned int textureId, bool depthBuffer) = 0;
+    virtual bool create(unsigned int width, unsigned int height, unsigned int textureId, const ContextSettings& settings) = 0;
 
     ////////////////////////////////////////////////////////////
     /// \brief Activate or deactivate the render texture for rendering
@@ -75,6 +76,9 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Update the pixels of the target texture
     ///
+    /// The implementation is responsible for activating
+    /// whatever it needs to perform the update.
+    ///
     /// \param textureId OpenGL identifier of the target texture
     ///
     ////////////////////////////////////////////////////////////
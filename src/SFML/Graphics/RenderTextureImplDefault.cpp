@@ -55,14 +55,14 @@ RenderTextureImplDefault::~RenderTextureImplDefault()
 
 
 ////////////////////////////////////////////////////////////
-bool RenderTextureImplDefault::create(unsigned int width, unsigned int height, unsigned int, bool depthBuffer)
+bool RenderTextureImplDefault::create(unsigned int width, unsigned int height, unsigned int, const ContextSettings& settings)
 {
     // Store the dimensions
     m_width = width;
     m_height = height;
 
     // Create the in-memory OpenGL context
-    m_context = new Context(ContextSettings(depthBuffer ? 32 : 0), width, height);
+    m_context = new Context(settings, width, height);
 
     return true;
 }
@@ -78,6 +78,10 @@ bool RenderTextureImplDefault::activate(bool active)
 ////////////////////////////////////////////////////////////
 void RenderTextureImplDefault::updateTexture(unsigned int textureId)
 {
+    // The pixels are copied from our context
+    if (!activate(true))
+        return;
+
     // Make sure that the current texture binding will be preserved
     priv::TextureSaver save;
 
@@ -28,7 +28,101 @@
 #include <SFML/Graphics/RenderTextureImplFBO.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Window/Context.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
 #include <SFML/System/Err.hpp>
+#include <vector>
+
+
+namespace
+{
+    // Frame buffers left by destroyed render textures in contexts which were not active at that time;
+    // they are deleted the next time that a render texture creates its frame buffers in their context
+    typedef std::vector<std::pair<sf::Uint64, unsigned int> > StaleFrameBuffers;
+    StaleFrameBuffers staleFrameBuffers;
+
+    // Frame buffer binding of the contexts used by render textures
+    typedef std::map<sf::Uint64, sf::priv::FrameBufferBinding> ContextBindings;
+    ContextBindings contextBindings;
+
+    sf::Mutex mutex;
+
+    // Get the binding of a context, it is created the first time that the context is used
+    sf::priv::FrameBufferBinding& findBinding(sf::Uint64 contextId)
+    {
+        sf::Lock lock(mutex);
+
+        ContextBindings::iterator it = contextBindings.find(contextId);
+        if (it == contextBindings.end())
+        {
+            GLint frameBuffer = 0;
+            glCheck(glGetIntegerv(GLEXT_GL_FRAMEBUFFER_BINDING, &frameBuffer));
+
+            sf::priv::FrameBufferBinding binding;
+            binding.defaultFrameBuffer = static_cast<unsigned int>(frameBuffer);
+            binding.currentFrameBuffer = static_cast<unsigned int>(frameBuffer);
+            it = contextBindings.insert(std::make_pair(contextId, binding)).first;
+        }
+
+        return it->second;
+    }
+
+    // Bind a frame buffer in the active context, unless it is already bound
+    void bindFrameBuffer(sf::priv::FrameBufferBinding& binding, unsigned int frameBuffer)
+    {
+        if (binding.currentFrameBuffer != frameBuffer)
+        {
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, frameBuffer));
+            binding.currentFrameBuffer = frameBuffer;
+        }
+    }
+
+    // Delete a frame buffer of the active context; if it was bound, OpenGL binds 0 instead
+    void deleteFrameBuffer(sf::priv::FrameBufferBinding& binding, unsigned int frameBuffer)
+    {
+        GLuint name = static_cast<GLuint>(frameBuffer);
+        glCheck(GLEXT_glDeleteFramebuffers(1, &name));
+
+        if (binding.currentFrameBuffer == frameBuffer)
+            binding.currentFrameBuffer = 0;
+    }
+
+    // Forget everything about a context which has been destroyed; its frame buffers died with it
+    void releaseContext(sf::Uint64 contextId)
+    {
+        sf::Lock lock(mutex);
+
+        contextBindings.erase(contextId);
+
+        for (StaleFrameBuffers::iterator it = staleFrameBuffers.begin(); it != staleFrameBuffers.end();)
+        {
+            if (it->first == contextId)
+                it = staleFrameBuffers.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    // Delete the stale frame buffers which belong to the active context
+    void destroyStaleFrameBuffers(sf::Uint64 contextId, sf::priv::FrameBufferBinding& binding)
+    {
+        sf::Lock lock(mutex);
+
+        for (StaleFrameBuffers::iterator it = staleFrameBuffers.begin(); it != staleFrameBuffers.end();)
+        {
+            if (it->first == contextId)
+            {
+                deleteFrameBuffer(binding, it->second);
+                it = staleFrameBuffers.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
 
 
 namespace sf
@@ -37,10 +131,19 @@ namespace priv
 {
 ////////////////////////////////////////////////////////////
 RenderTextureImplFBO::RenderTextureImplFBO() :
-m_frameBuffer(0),
-m_depthBuffer(0)
+m_frameBuffers           (),
+m_multisampleFrameBuffers(),
+m_contextId              (0),
+m_binding                (NULL),
+m_textureId              (0),
+m_width                  (0),
+m_height                 (0),
+m_depthBuffer            (0),
+m_colorBuffer            (0),
+m_multisample            (false),
+m_modified               (false)
 {
-
+    registerContextDestroyCallback(&releaseContext);
 }
 
 
@@ -49,22 +152,37 @@ RenderTextureImplFBO::~RenderTextureImplFBO()
 {
     ensureGlContext();
 
-    // Destroy the depth buffer
+    // Destroy the render buffers
     if (m_depthBuffer)
     {
         GLuint depthBuffer = static_cast<GLuint>(m_depthBuffer);
         glCheck(GLEXT_glDeleteRenderbuffers(1, &depthBuffer));
     }
-
-    // Destroy the frame buffer
-    if (m_frameBuffer)
+    if (m_colorBuffer)
     {
-        GLuint frameBuffer = static_cast<GLuint>(m_frameBuffer);
-        glCheck(GLEXT_glDeleteFramebuffers(1, &frameBuffer));
+        GLuint colorBuffer = static_cast<GLuint>(m_colorBuffer);
+        glCheck(GLEXT_glDeleteRenderbuffers(1, &colorBuffer));
     }
 
-    // Delete the context
-    delete m_context;
+    // Destroy the frame buffers of the active context, the other ones will be
+    // destroyed the next time that a render texture is created in their context
+    Uint64 contextId = Context::getActiveContextId();
+    FrameBufferTable* tables[] = {&m_frameBuffers, &m_multisampleFrameBuffers};
+    for (int i = 0; i < 2; ++i)
+    {
+        for (FrameBufferTable::iterator it = tables[i]->begin(); it != tables[i]->end(); ++it)
+        {
+            if (it->first == contextId)
+            {
+                deleteFrameBuffer(getBinding(), it->second);
+            }
+            else
+            {
+                Lock lock(mutex);
+                staleFrameBuffers.push_back(*it);
+            }
+        }
+    }
 }
 
 
@@ -81,24 +199,78 @@ bool RenderTextureImplFBO::isAvailable()
 
 
 ////////////////////////////////////////////////////////////
-bool RenderTextureImplFBO::create(unsigned int width, unsigned int height, unsigned int textureId, bool depthBuffer)
+void RenderTextureImplFBO::bindDefaultFrameBuffer(Uint64& contextId, FrameBufferBinding*& binding)
 {
-    // Create the context
-    m_context = new Context;
+    // Without frame buffer objects, no render texture can have changed the binding
+    if (!GLEXT_framebuffer_object)
+        return;
 
-    // Create the framebuffer object
-    GLuint frameBuffer = 0;
-    glCheck(GLEXT_glGenFramebuffers(1, &frameBuffer));
-    m_frameBuffer = static_cast<unsigned int>(frameBuffer);
-    if (!m_frameBuffer)
+    Uint64 activeContextId = Context::getActiveContextId();
+    if (activeContextId != contextId)
     {
-        err() << "Impossible to create render texture (failed to create the frame buffer object)" << std::endl;
-        return false;
+        binding = &findBinding(activeContextId);
+        contextId = activeContextId;
+    }
+
+    bindFrameBuffer(*binding, binding->defaultFrameBuffer);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTextureImplFBO::bindDefaultFrameBuffer()
+{
+    Uint64 contextId = 0;
+    FrameBufferBinding* binding = NULL;
+    bindDefaultFrameBuffer(contextId, binding);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int RenderTextureImplFBO::getMaximumAntialiasingLevel()
+{
+    ensureGlContext();
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    // Resolving requires blitting from a frame buffer to another
+    if (!GLEXT_framebuffer_multisample || !GLEXT_framebuffer_blit)
+        return 0;
+
+    GLint samples = 0;
+    #ifndef SFML_OPENGL_ES
+        glCheck(glGetIntegerv(GLEXT_GL_MAX_SAMPLES, &samples));
+    #endif
+
+    return static_cast<unsigned int>(samples);
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTextureImplFBO::create(unsigned int width, unsigned int height, unsigned int textureId, const ContextSettings& settings)
+{
+    m_textureId = textureId;
+    m_width     = width;
+    m_height    = height;
+
+    ensureGlContext();
+
+    // Check the antialiasing level
+    unsigned int samples = settings.antialiasingLevel;
+    if (samples > 0)
+    {
+        unsigned int maxSamples = getMaximumAntialiasingLevel();
+        if (samples > maxSamples)
+        {
+            err() << "Antialiasing level " << samples << " is not supported by render textures, "
+                  << "using " << maxSamples << " instead" << std::endl;
+            samples = maxSamples;
+        }
     }
-    glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, m_frameBuffer));
+    m_multisample = (samples > 0);
 
-    // Create the depth buffer if requested
-    if (depthBuffer)
+    // Create the render buffers; unlike frame buffers, they are shared by all the contexts
+    if (settings.depthBits > 0)
     {
         GLuint depth = 0;
         glCheck(GLEXT_glGenRenderbuffers(1, &depth));
@@ -109,22 +281,127 @@ bool RenderTextureImplFBO::create(unsigned int width, unsigned int height, unsig
             return false;
         }
         glCheck(GLEXT_glBindRenderbuffer(GLEXT_GL_RENDERBUFFER, m_depthBuffer));
-        glCheck(GLEXT_glRenderbufferStorage(GLEXT_GL_RENDERBUFFER, GLEXT_GL_DEPTH_COMPONENT, width, height));
-        glCheck(GLEXT_glFramebufferRenderbuffer(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_DEPTH_ATTACHMENT, GLEXT_GL_RENDERBUFFER, m_depthBuffer));
+        #ifndef SFML_OPENGL_ES
+            if (m_multisample)
+            {
+                glCheck(GLEXT_glRenderbufferStorageMultisample(GLEXT_GL_RENDERBUFFER, samples, GLEXT_GL_DEPTH_COMPONENT, width, height));
+            }
+            else
+        #endif
+        {
+            glCheck(GLEXT_glRenderbufferStorage(GLEXT_GL_RENDERBUFFER, GLEXT_GL_DEPTH_COMPONENT, width, height));
+        }
+    }
+
+    #ifndef SFML_OPENGL_ES
+        if (m_multisample)
+        {
+            GLuint color = 0;
+            glCheck(GLEXT_glGenRenderbuffers(1, &color));
+            m_colorBuffer = static_cast<unsigned int>(color);
+            if (!m_colorBuffer)
+            {
+                err() << "Impossible to create render texture (failed to create the multisampled color buffer)" << std::endl;
+                return false;
+            }
+            glCheck(GLEXT_glBindRenderbuffer(GLEXT_GL_RENDERBUFFER, m_colorBuffer));
+            glCheck(GLEXT_glRenderbufferStorageMultisample(GLEXT_GL_RENDERBUFFER, samples, GL_RGBA8, width, height));
+        }
+    #endif
+
+    // Create the frame buffers of the active context right away, to report errors
+    // early; make sure that the current frame buffer binding is preserved
+    FrameBufferBinding& binding = getBinding();
+    unsigned int previousFrameBuffer = binding.currentFrameBuffer;
+
+    bool success = createFrameBuffers();
+
+    bindFrameBuffer(binding, previousFrameBuffer);
+
+    return success;
+}
+
+
+////////////////////////////////////////////////////////////
+FrameBufferBinding& RenderTextureImplFBO::getBinding()
+{
+    Uint64 contextId = Context::getActiveContextId();
+    if (contextId != m_contextId)
+    {
+        m_binding = &findBinding(contextId);
+        m_contextId = contextId;
+    }
+
+    return *m_binding;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTextureImplFBO::createFrameBuffers()
+{
+    Uint64 contextId = Context::getActiveContextId();
+    FrameBufferBinding& binding = getBinding();
+
+    // Take the opportunity to clean up the frame buffers of destroyed render textures
+    destroyStaleFrameBuffers(contextId, binding);
+
+    // Create the framebuffer object attached to the texture
+    GLuint frameBuffer = 0;
+    glCheck(GLEXT_glGenFramebuffers(1, &frameBuffer));
+    if (!frameBuffer)
+    {
+        err() << "Impossible to create render texture (failed to create the frame buffer object)" << std::endl;
+        return false;
     }
+    bindFrameBuffer(binding, frameBuffer);
+
+    // Attach the depth buffer, if any (multisampled buffers go to the other frame buffer)
+    if (m_depthBuffer && !m_multisample)
+        glCheck(GLEXT_glFramebufferRenderbuffer(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_DEPTH_ATTACHMENT, GLEXT_GL_RENDERBUFFER, m_depthBuffer));
 
     // Link the texture to the frame buffer
-    glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureId, 0));
+    glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_textureId, 0));
 
     // A final check, just to be sure...
     GLenum status = glCheck(GLEXT_glCheckFramebufferStatus(GLEXT_GL_FRAMEBUFFER));
     if (status != GLEXT_GL_FRAMEBUFFER_COMPLETE)
     {
-        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, 0));
+        bindFrameBuffer(binding, binding.defaultFrameBuffer);
+        deleteFrameBuffer(binding, frameBuffer);
         err() << "Impossible to create render texture (failed to link the target texture to the frame buffer)" << std::endl;
         return false;
     }
 
+    m_frameBuffers[contextId] = static_cast<unsigned int>(frameBuffer);
+
+    if (!m_multisample)
+        return true;
+
+    // Create the framebuffer object attached to the multisampled buffers
+    GLuint multisampleFrameBuffer = 0;
+    glCheck(GLEXT_glGenFramebuffers(1, &multisampleFrameBuffer));
+    if (!multisampleFrameBuffer)
+    {
+        err() << "Impossible to create render texture (failed to create the multisampled frame buffer object)" << std::endl;
+        return false;
+    }
+    bindFrameBuffer(binding, multisampleFrameBuffer);
+
+    glCheck(GLEXT_glFramebufferRenderbuffer(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GLEXT_GL_RENDERBUFFER, m_colorBuffer));
+    if (m_depthBuffer)
+        glCheck(GLEXT_glFramebufferRenderbuffer(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_DEPTH_ATTACHMENT, GLEXT_GL_RENDERBUFFER, m_depthBuffer));
+
+    status = glCheck(GLEXT_glCheckFramebufferStatus(GLEXT_GL_FRAMEBUFFER));
+    if (status != GLEXT_GL_FRAMEBUFFER_COMPLETE)
+    {
+        bindFrameBuffer(binding, binding.defaultFrameBuffer);
+        deleteFrameBuffer(binding, multisampleFrameBuffer);
+        err() << "Impossible to create render texture (failed to link the multisampled buffers to the frame buffer)" << std::endl;
+        return false;
+    }
+
+    m_multisampleFrameBuffers[contextId] = static_cast<unsigned int>(multisampleFrameBuffer);
+
     return true;
 }
 
@@ -132,13 +409,62 @@ bool RenderTextureImplFBO::create(unsigned int width, unsigned int height, unsig
 ////////////////////////////////////////////////////////////
 bool RenderTextureImplFBO::activate(bool active)
 {
-    return m_context->setActive(active);
+    // Render from whatever context is active on this thread,
+    // there's always one after this call
+    ensureGlContext();
+
+    FrameBufferBinding& binding = getBinding();
+
+    if (!active)
+    {
+        bindFrameBuffer(binding, binding.defaultFrameBuffer);
+        return true;
+    }
+
+    // Whatever happens next, the contents will have to be resolved
+    m_modified = true;
+
+    // Bind the frame buffer of this context (nothing to do if it is still bound),
+    // or create it if it is used for the first time
+    const FrameBufferTable& frameBuffers = m_multisample ? m_multisampleFrameBuffers : m_frameBuffers;
+    FrameBufferTable::const_iterator it = frameBuffers.find(m_contextId);
+    if (it != frameBuffers.end())
+    {
+        bindFrameBuffer(binding, it->second);
+        return true;
+    }
+
+    return createFrameBuffers();
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTextureImplFBO::updateTexture(unsigned int)
 {
+    ensureGlContext();
+
+    // Resolve the multisampled buffers into the texture, if they changed since the last time
+    #ifndef SFML_OPENGL_ES
+        if (m_multisample && m_modified)
+        {
+            Uint64 contextId = Context::getActiveContextId();
+            if ((m_frameBuffers.find(contextId) == m_frameBuffers.end()) && !createFrameBuffers())
+                return;
+
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_READ_FRAMEBUFFER, m_multisampleFrameBuffers[contextId]));
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, m_frameBuffers[contextId]));
+            glCheck(GLEXT_glBlitFramebuffer(0, 0, m_width, m_height, 0, 0, m_width, m_height, GL_COLOR_BUFFER_BIT, GL_NEAREST));
+
+            // Leave the frame buffer bound like activate would; the read and draw
+            // bindings differ, so the binding must be set even if it looks unchanged
+            FrameBufferBinding& binding = getBinding();
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, m_multisampleFrameBuffers[contextId]));
+            binding.currentFrameBuffer = m_multisampleFrameBuffers[contextId];
+
+            m_modified = false;
+        }
+    #endif
+
     glCheck(glFlush());
 }
 
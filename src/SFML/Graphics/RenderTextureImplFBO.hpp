@@ -29,18 +29,46 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/RenderTextureImpl.hpp>
-#include <SFML/Window/Context.hpp>
 #include <SFML/Window/GlResource.hpp>
+#include <map>
 
 
 namespace sf
 {
 namespace priv
 {
+////////////////////////////////////////////////////////////
+/// \brief Frame buffer binding of a context
+///
+/// The bindings are created the first time that a context
+/// is used and destroyed with their context. They are only
+/// modified by the thread where their context is active, so
+/// the users of a context can keep a pointer to its binding
+/// and read it without locking, as long as they check that
+/// the context is still the active one.
+///
+////////////////////////////////////////////////////////////
+struct FrameBufferBinding
+{
+    unsigned int defaultFrameBuffer; ///< Frame buffer bound when the context was first used (not always 0)
+    unsigned int currentFrameBuffer; ///< Frame buffer bound now
+};
+
 ////////////////////////////////////////////////////////////
 /// \brief Specialization of RenderTextureImpl using the
 ///        FrameBuffer Object OpenGL extension
 ///
+/// Frame buffer objects can't be shared between contexts,
+/// so instead of owning a context, the implementation
+/// renders from the context which is active on the calling
+/// thread and creates one frame buffer for each context that
+/// it is used with. Activating it is then just a matter of
+/// binding the right frame buffer.
+///
+/// When antialiasing is requested, rendering goes to a second
+/// frame buffer made of multisampled render buffers, which is
+/// resolved into the target texture when the texture is updated.
+///
 ////////////////////////////////////////////////////////////
 class RenderTextureImplFBO : public RenderTextureImpl, GlResource
 {
@@ -66,20 +94,79 @@ public:
     ////////////////////////////////////////////////////////////
     static bool isAvailable();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the default frame buffer of the active context
+    ///
+    /// Render textures leave their frame buffer bound in the
+    /// context that they use, so anything that renders to or
+    /// reads from the default frame buffer of a context (i.e.
+    /// its window) must restore it first. The binding is only
+    /// changed if a render texture used the context since the
+    /// last call.
+    ///
+    /// The caller keeps the context and the binding found by
+    /// the previous call, so that the binding is looked up
+    /// (with a lock) only when the active context changes.
+    ///
+    /// \param contextId Context of the previous call, updated
+    /// \param binding   Binding of this context, updated
+    ///
+    ////////////////////////////////////////////////////////////
+    static void bindDefaultFrameBuffer(Uint64& contextId, FrameBufferBinding*& binding);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the default frame buffer of the active context
+    ///
+    /// This overload looks up the binding of the context every
+    /// time, it is meant for occasional calls.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void bindDefaultFrameBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of samples supported for antialiasing
+    ///
+    /// \return Maximum antialiasing level, 0 if multisampled frame buffers are not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    static unsigned int getMaximumAntialiasingLevel();
+
 private:
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the frame buffer binding of the active context
+    ///
+    /// The binding is only looked up when the active context
+    /// is not the same as in the previous call.
+    ///
+    /// \return Binding of the active context
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameBufferBinding& getBinding();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the frame buffer objects of the active context
+    ///
+    /// The frame buffer that rendering goes to (the multisampled
+    /// one if antialiasing is enabled) is left bound.
+    ///
+    /// \return True if creation has been successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool createFrameBuffers();
+
     ////////////////////////////////////////////////////////////
     /// \brief Create the render texture implementation
     ///
-    /// \param width       Width of the texture to render to
-    /// \param height      Height of the texture to render to
-    /// \param textureId   OpenGL identifier of the target texture
-    /// \param depthBuffer Is a depth buffer requested?
+    /// \param width     Width of the texture to render to
+    /// \param height    Height of the texture to render to
+    /// \param textureId OpenGL identifier of the target texture
+    /// \param settings  Settings of the buffers to create
     ///
     /// \return True if creation has been successful
     ///
     ////////////////////////////////////////////////////////////
-    virtual bool create(unsigned int width, unsigned int height, unsigned int textureId, bool depthBuffer);
+    virtual bool create(unsigned int width, unsigned int height, unsigned int textureId, const ContextSettings& settings);
 
     ////////////////////////////////////////////////////////////
     /// \brief Activate or deactivate the render texture for rendering
@@ -102,9 +189,19 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Context*     m_context;     ///< Needs a separate OpenGL context for not messing up the other ones
-    unsigned int m_frameBuffer; ///< OpenGL frame buffer object
-    unsigned int m_depthBuffer; ///< Optional depth buffer attached to the frame buffer
+    typedef std::map<Uint64, unsigned int> FrameBufferTable;
+
+    FrameBufferTable    m_frameBuffers;            ///< Frame buffer objects attached to the target texture, one per context
+    FrameBufferTable    m_multisampleFrameBuffers; ///< Frame buffer objects attached to the multisampled buffers, one per context
+    Uint64              m_contextId;               ///< Context of the last call to getBinding
+    FrameBufferBinding* m_binding;                 ///< Frame buffer binding of this context
+    unsigned int        m_textureId;               ///< OpenGL identifier of the target texture
+    unsigned int        m_width;                   ///< Width of the buffers
+    unsigned int        m_height;                  ///< Height of the buffers
+    unsigned int        m_depthBuffer;             ///< Optional depth buffer attached to the frame buffers
+    unsigned int        m_colorBuffer;             ///< Multisampled color buffer, if antialiasing is enabled
+    bool                m_multisample;             ///< Is antialiasing enabled?
+    bool                m_modified;                ///< Has anything been rendered since the last resolve?
 };
 
 } // namespace priv
@@ -26,20 +26,25 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTextureImplFBO.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-RenderWindow::RenderWindow()
+RenderWindow::RenderWindow() :
+m_contextId         (0),
+m_frameBufferBinding(NULL)
 {
     // Nothing to do
 }
 
 
 ////////////////////////////////////////////////////////////
-RenderWindow::RenderWindow(VideoMode mode, const String& title, Uint32 style, const ContextSettings& settings)
+RenderWindow::RenderWindow(VideoMode mode, const String& title, Uint32 style, const ContextSettings& settings) :
+m_contextId         (0),
+m_frameBufferBinding(NULL)
 {
     // Don't call the base class constructor because it contains virtual function calls
     create(mode, title, style, settings);
@@ -47,7 +52,9 @@ RenderWindow::RenderWindow(VideoMode mode, const String& title, Uint32 style, co
 
 
 ////////////////////////////////////////////////////////////
-RenderWindow::RenderWindow(WindowHandle handle, const ContextSettings& settings)
+RenderWindow::RenderWindow(WindowHandle handle, const ContextSettings& settings) :
+m_contextId         (0),
+m_frameBufferBinding(NULL)
 {
     // Don't call the base class constructor because it contains virtual function calls
     create(handle, settings);
@@ -75,6 +82,21 @@ Vector2u RenderWindow::getSize() const
 }
 
 
+////////////////////////////////////////////////////////////
+bool RenderWindow::setActive(bool active) const
+{
+    if (!Window::setActive(active))
+        return false;
+
+    // Render textures bind their frame buffer in the active context,
+    // which may be ours: make sure that we target the window
+    if (active)
+        priv::RenderTextureImplFBO::bindDefaultFrameBuffer(m_contextId, m_frameBufferBinding);
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 Image RenderWindow::capture() const
 {
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ResourceAccess.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Shader.hpp>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+unsigned int ResourceAccess::getHandle(const Texture& texture)
+{
+    return texture.m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 ResourceAccess::getCacheId(const Texture& texture)
+{
+    return texture.m_cacheId;
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 ResourceAccess::getCacheId(const Shader& shader)
+{
+    return shader.m_cacheId;
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 ResourceAccess::getParametersId(const Shader& shader)
+{
+    return shader.m_parametersId;
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 ResourceAccess::getTexturesId(const Shader& shader)
+{
+    return shader.getTexturesCacheId();
+}
+
+
+////////////////////////////////////////////////////////////
+void ResourceAccess::bindTextures(const Shader& shader)
+{
+    shader.bindTextures();
+}
+
+
+////////////////////////////////////////////////////////////
+void ResourceAccess::uploadUniforms(const Shader& shader)
+{
+    shader.uploadUniforms();
+}
+
+
+////////////////////////////////////////////////////////////
+void ResourceAccess::markAsModified(Texture& texture)
+{
+    texture.markAsModified();
+}
+
+
+////////////////////////////////////////////////////////////
+void ResourceAccess::setEvictable(Texture& texture, bool evictable)
+{
+    texture.m_isEvictable = evictable;
+}
+
+
+////////////////////////////////////////////////////////////
+void ResourceAccess::evict(const Texture& texture)
+{
+    texture.evict();
+}
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_RESOURCEACCESS_HPP
+#define SFML_RESOURCEACCESS_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+
+
+namespace sf
+{
+class Texture;
+class Shader;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Internal access to the OpenGL objects of textures and shaders
+///
+/// The graphics classes which need the internals of a
+/// texture or a shader go through this class, instead of
+/// being friends of sf::Texture or sf::Shader.
+///
+////////////////////////////////////////////////////////////
+class ResourceAccess
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the OpenGL handle of a texture
+    ///
+    /// \param texture Texture to query
+    ///
+    /// \return OpenGL texture name, 0 if the texture has no pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    static unsigned int getHandle(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the cache identifier of a texture
+    ///
+    /// The identifier changes whenever the contents of the
+    /// texture change.
+    ///
+    /// \param texture Texture to query
+    ///
+    /// \return Unique identifier of the current contents
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getCacheId(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the cache identifier of a shader program
+    ///
+    /// \param shader Shader to query
+    ///
+    /// \return Unique identifier of the program
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getCacheId(const Shader& shader);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the identifier of the parameter values of a shader
+    ///
+    /// The identifier is a counter of the shader, it must be
+    /// compared together with its cache identifier.
+    ///
+    /// \param shader Shader to query
+    ///
+    /// \return Number that changes whenever a parameter is modified
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getParametersId(const Shader& shader);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the identifier of the texture bindings of a shader
+    ///
+    /// \param shader Shader to query
+    ///
+    /// \return Number that changes whenever the textures would be bound differently
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getTexturesId(const Shader& shader);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the textures used by a shader
+    ///
+    /// The shader program must be bound.
+    ///
+    /// \param shader Shader whose textures are bound
+    ///
+    ////////////////////////////////////////////////////////////
+    static void bindTextures(const Shader& shader);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the uniforms of a shader which changed since the last upload
+    ///
+    /// The shader program must be bound.
+    ///
+    /// \param shader Shader whose uniforms are uploaded
+    ///
+    ////////////////////////////////////////////////////////////
+    static void uploadUniforms(const Shader& shader);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Invalidate the cache identifier of a texture
+    ///
+    /// This function must be called after the pixels of a
+    /// texture were changed directly with OpenGL.
+    ///
+    /// \param texture Texture which was modified
+    ///
+    ////////////////////////////////////////////////////////////
+    static void markAsModified(Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Allow or forbid the eviction of a texture
+    ///
+    /// This must be set before the texture is created.
+    ///
+    /// \param texture   Texture to change
+    /// \param evictable True if the texture can be moved out of the video memory
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setEvictable(Texture& texture, bool evictable);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move the pixels of a texture to the system memory
+    ///
+    /// \param texture Texture to evict
+    ///
+    ////////////////////////////////////////////////////////////
+    static void evict(const Texture& texture);
+};
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_RESOURCEACCESS_HPP
@@ -28,14 +28,21 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/ResourceAccess.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Window/Context.hpp>
 #include <SFML/System/InputStream.hpp>
 #include <SFML/System/Mutex.hpp>
 #include <SFML/System/Lock.hpp>
 #include <SFML/System/Err.hpp>
+#include <algorithm>
 #include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <vector>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
 
 
 #ifndef SFML_OPENGL_ES
@@ -64,6 +71,17 @@ namespace
         return maxUnits;
     }
 
+    // Thread-safe unique identifier generator,
+    // is used for states cache (see RenderTarget)
+    sf::Uint64 getUniqueId()
+    {
+        sf::Lock lock(mutex);
+
+        static sf::Uint64 id = 1; // start at 1, zero is "no shader"
+
+        return id++;
+    }
+
     // Retrieve the maximum number of texture units available
     GLint getMaxTextureUnits()
     {
@@ -132,6 +150,191 @@ namespace
 
         return available;
     }
+
+    // Directory of the program binary cache, empty when disabled
+    std::string binaryCacheDirectory;
+
+    // Header of the files stored in the program binary cache
+    struct BinaryCacheHeader
+    {
+        char       magic[4];
+        sf::Uint32 driverHash;
+        sf::Uint32 sourceSize;
+        sf::Uint32 format;
+        sf::Uint32 size;
+    };
+
+    // Hash a string with the FNV-1a algorithm
+    sf::Uint32 hashString(const char* string, sf::Uint32 hash = 2166136261u)
+    {
+        if (string)
+        {
+            for (; *string; ++string)
+                hash = (hash ^ static_cast<unsigned char>(*string)) * 16777619u;
+        }
+
+        return hash;
+    }
+
+    // Hash the strings identifying the current driver
+    sf::Uint32 getDriverHash()
+    {
+        sf::Uint32 hash = hashString(reinterpret_cast<const char*>(glGetString(GL_VENDOR)));
+        hash = hashString("\n", hash);
+        hash = hashString(reinterpret_cast<const char*>(glGetString(GL_RENDERER)), hash);
+        hash = hashString("\n", hash);
+        return hashString(reinterpret_cast<const char*>(glGetString(GL_VERSION)), hash);
+    }
+
+    // Build the full source code that a cache entry describes; the markers of the stages
+    // make sure that a vertex shader and a fragment shader with the same code differ
+    std::string getSourceKey(const char* vertexShaderCode, const char* fragmentShaderCode)
+    {
+        std::string key(vertexShaderCode ? "v" : "-");
+        if (vertexShaderCode)
+            key += vertexShaderCode;
+        key += '\0';
+        key += fragmentShaderCode ? "f" : "-";
+        if (fragmentShaderCode)
+            key += fragmentShaderCode;
+
+        return key;
+    }
+
+    // Get the path of the cache entry for the given source code, or an empty string if the cache can't be used
+    std::string getBinaryCachePath(const std::string& sourceKey)
+    {
+        std::string directory;
+        {
+            sf::Lock lock(mutex);
+            directory = binaryCacheDirectory;
+        }
+
+        if (directory.empty() || !GLEXT_get_program_binary)
+            return "";
+
+        // The driver may expose the extension without supporting any binary format
+        GLint formats = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS, &formats));
+        if (formats <= 0)
+            return "";
+
+        // The hash only names the entry: the full source code is stored in
+        // the entry and compared, so that collisions are detected
+        sf::Uint32 hash = 2166136261u;
+        for (std::string::const_iterator it = sourceKey.begin(); it != sourceKey.end(); ++it)
+            hash = (hash ^ static_cast<unsigned char>(*it)) * 16777619u;
+
+        std::ostringstream path;
+        path << directory;
+        if ((directory[directory.size() - 1] != '/') && (directory[directory.size() - 1] != '\\'))
+            path << '/';
+        path << std::hex << std::setfill('0') << std::setw(8) << hash << ".bin";
+
+        return path.str();
+    }
+
+    // Create a program from a cache entry, returns 0 if the entry is missing, stale or rejected by the driver
+    unsigned int loadProgramBinary(const std::string& path, const std::string& sourceKey)
+    {
+        std::ifstream file(path.c_str(), std::ios_base::binary);
+        if (!file)
+            return 0;
+
+        // The sizes stored in the header are checked against the size of the file
+        // before anything is allocated, a corrupt entry can't ask for a huge buffer
+        file.seekg(0, std::ios_base::end);
+        std::streamoff fileSize = file.tellg();
+        file.seekg(0, std::ios_base::beg);
+        if (!file || (fileSize < static_cast<std::streamoff>(sizeof(BinaryCacheHeader))))
+            return 0;
+        sf::Uint64 remaining = static_cast<sf::Uint64>(fileSize) - sizeof(BinaryCacheHeader);
+
+        // Check that the entry was created by the same driver for the same source code
+        BinaryCacheHeader header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            (std::memcmp(header.magic, "SFP2", 4) != 0) ||
+            (header.driverHash != getDriverHash()) ||
+            (header.sourceSize != sourceKey.size()) ||
+            (header.sourceSize > remaining) ||
+            (header.size == 0) ||
+            (header.size > remaining - header.sourceSize))
+            return 0;
+
+        // Compare the whole source code, the file name is only a hash of it
+        std::vector<char> source(sourceKey.size());
+        if (!source.empty() && (!file.read(&source[0], source.size()) || !std::equal(source.begin(), source.end(), sourceKey.begin())))
+            return 0;
+
+        std::vector<char> binary(header.size);
+        if (!file.read(&binary[0], header.size))
+            return 0;
+
+        // Let the driver validate the binary, it may still reject it
+        GLEXT_GLhandle program = glCheck(GLEXT_glCreateProgramObject());
+        glCheck(GLEXT_glProgramBinary(castFromGlHandle(program), header.format, &binary[0], static_cast<GLsizei>(header.size)));
+
+        GLint success;
+        glCheck(GLEXT_glGetObjectParameteriv(program, GLEXT_GL_OBJECT_LINK_STATUS, &success));
+        if (success == GL_FALSE)
+        {
+            glCheck(GLEXT_glDeleteObject(program));
+            return 0;
+        }
+
+        return castFromGlHandle(program);
+    }
+
+    // Store the binary of a linked program into the cache
+    void saveProgramBinary(const std::string& path, unsigned int program, const std::string& sourceKey)
+    {
+        // Program objects answer this query like glGetProgramiv does
+        GLint size = 0;
+        glCheck(GLEXT_glGetObjectParameteriv(castToGlHandle(program), GLEXT_GL_PROGRAM_BINARY_LENGTH, &size));
+        if (size <= 0)
+            return;
+
+        std::vector<char> binary(static_cast<std::size_t>(size));
+        GLsizei length = 0;
+        GLenum format = 0;
+        glCheck(GLEXT_glGetProgramBinary(program, size, &length, &format, &binary[0]));
+        if (length <= 0)
+            return;
+
+        BinaryCacheHeader header;
+        std::memcpy(header.magic, "SFP2", 4);
+        header.driverHash = getDriverHash();
+        header.sourceSize = static_cast<sf::Uint32>(sourceKey.size());
+        header.format     = format;
+        header.size       = static_cast<sf::Uint32>(length);
+
+        // Write to a temporary file first and move it in place, so that a crash or another
+        // process writing the same entry never leaves a truncated file behind
+        std::ostringstream temporaryPath;
+        temporaryPath << path << '.' << std::hex << reinterpret_cast<std::size_t>(&binary) << '.' << std::time(NULL) << ".tmp";
+        std::string temporary = temporaryPath.str();
+
+        bool written = false;
+        {
+            std::ofstream file(temporary.c_str(), std::ios_base::binary | std::ios_base::trunc);
+            written = file.write(reinterpret_cast<const char*>(&header), sizeof(header)) &&
+                      file.write(sourceKey.data(), sourceKey.size()) &&
+                      file.write(&binary[0], length);
+        }
+
+        // std::rename doesn't replace an existing file on every platform
+        if (written && (std::rename(temporary.c_str(), path.c_str()) != 0))
+        {
+            std::remove(path.c_str());
+            written = std::rename(temporary.c_str(), path.c_str()) == 0;
+        }
+
+        if (!written)
+        {
+            std::remove(temporary.c_str());
+            sf::err() << "Failed to write shader binary cache file \"" << path << "\"" << std::endl;
+        }
+    }
 }
 
 
@@ -146,7 +349,11 @@ Shader::Shader() :
 m_shaderProgram (0),
 m_currentTexture(-1),
 m_textures      (),
-m_params        ()
+m_params        (),
+m_uniforms      (),
+m_uniformsDirty (false),
+m_cacheId       (getUniqueId()),
+m_parametersId  (m_cacheId)
 {
 }
 
@@ -283,6 +490,7 @@ void Shader::setParameter(const std::string& name, float x)
         if (location != -1)
         {
             glCheck(GLEXT_glUniform1f(location, x));
+            ++m_parametersId;
         }
 
         // Disable program
@@ -307,6 +515,7 @@ void Shader::setParameter(const std::string& name, float x, float y)
         if (location != -1)
         {
             glCheck(GLEXT_glUniform2f(location, x, y));
+            ++m_parametersId;
         }
 
         // Disable program
@@ -331,6 +540,7 @@ void Shader::setParameter(const std::string& name, float x, float y, float z)
         if (location != -1)
         {
             glCheck(GLEXT_glUniform3f(location, x, y, z));
+            ++m_parametersId;
         }
 
         // Disable program
@@ -355,6 +565,7 @@ void Shader::setParameter(const std::string& name, float x, float y, float z, fl
         if (location != -1)
         {
             glCheck(GLEXT_glUniform4f(location, x, y, z, w));
+            ++m_parametersId;
         }
 
         // Disable program
@@ -400,6 +611,7 @@ void Shader::setParameter(const std::string& name, const sf::Transform& transfor
         if (location != -1)
         {
             glCheck(GLEXT_glUniformMatrix4fv(location, 1, GL_FALSE, transform.getMatrix()));
+            ++m_parametersId;
         }
 
         // Disable program
@@ -456,6 +668,96 @@ void Shader::setParameter(const std::string& name, CurrentTextureType)
 }
 
 
+////////////////////////////////////////////////////////////
+int Shader::getUniformHandle(const std::string& name)
+{
+    if (!m_shaderProgram)
+        return -1;
+
+    ensureGlContext();
+
+    // Find the location of the variable in the shader
+    int location = getParamLocation(name);
+    if (location == -1)
+        return -1;
+
+    // Reuse the handle if the variable was already requested
+    for (std::size_t i = 0; i < m_uniforms.size(); ++i)
+    {
+        if (m_uniforms[i].location == location)
+            return static_cast<int>(i);
+    }
+
+    // New variable, create an empty slot for it
+    Uniform uniform;
+    uniform.location = location;
+    uniform.count    = 0;
+    uniform.dirty    = false;
+    m_uniforms.push_back(uniform);
+
+    return static_cast<int>(m_uniforms.size() - 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, float x)
+{
+    storeUniform(handle, &x, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, float x, float y)
+{
+    float values[] = {x, y};
+    storeUniform(handle, values, 2);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, float x, float y, float z)
+{
+    float values[] = {x, y, z};
+    storeUniform(handle, values, 3);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, float x, float y, float z, float w)
+{
+    float values[] = {x, y, z, w};
+    storeUniform(handle, values, 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, const Vector2f& v)
+{
+    setUniform(handle, v.x, v.y);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, const Vector3f& v)
+{
+    setUniform(handle, v.x, v.y, v.z);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, const Color& color)
+{
+    setUniform(handle, color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, const sf::Transform& transform)
+{
+    storeUniform(handle, transform.getMatrix(), 16);
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
@@ -481,12 +783,11 @@ void Shader::bind(const Shader* shader)
         // Enable the program
         glCheck(GLEXT_glUseProgramObject(castToGlHandle(shader->m_shaderProgram)));
 
+        // Upload the uniforms that changed since the last bind
+        shader->uploadUniforms();
+
         // Bind the textures
         shader->bindTextures();
-
-        // Bind the current texture
-        if (shader->m_currentTexture != -1)
-            glCheck(GLEXT_glUniform1i(shader->m_currentTexture, 0));
     }
     else
     {
@@ -508,6 +809,16 @@ bool Shader::isAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setBinaryCacheDirectory(const std::string& directory)
+{
+    // TODO: Remove this lock when it becomes unnecessary in C++11
+    Lock lock(mutex);
+
+    binaryCacheDirectory = directory;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Shader::compile(const char* vertexShaderCode, const char* fragmentShaderCode)
 {
@@ -532,6 +843,23 @@ bool Shader::compile(const char* vertexShaderCode, const char* fragmentShaderCod
     m_currentTexture = -1;
     m_textures.clear();
     m_params.clear();
+    m_uniforms.clear();
+    m_uniformsDirty = false;
+    m_cacheId = getUniqueId();
+    m_parametersId = m_cacheId;
+
+    // Reuse the program linked by a previous run if it is in the binary cache
+    std::string sourceKey = getSourceKey(vertexShaderCode, fragmentShaderCode);
+    std::string cachePath = getBinaryCachePath(sourceKey);
+    if (!cachePath.empty())
+    {
+        m_shaderProgram = loadProgramBinary(cachePath, sourceKey);
+        if (m_shaderProgram)
+        {
+            glCheck(glFlush());
+            return true;
+        }
+    }
 
     // Create the program
     GLEXT_GLhandle shaderProgram = glCheck(GLEXT_glCreateProgramObject());
@@ -590,6 +918,10 @@ bool Shader::compile(const char* vertexShaderCode, const char* fragmentShaderCod
         glCheck(GLEXT_glDeleteObject(fragmentShader));
     }
 
+    // Ask the driver to keep the binary around if we are going to cache it
+    if (!cachePath.empty())
+        glCheck(GLEXT_glProgramParameteri(castFromGlHandle(shaderProgram), GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+
     // Link the program
     glCheck(GLEXT_glLinkProgram(shaderProgram));
 
@@ -608,6 +940,10 @@ bool Shader::compile(const char* vertexShaderCode, const char* fragmentShaderCod
 
     m_shaderProgram = castFromGlHandle(shaderProgram);
 
+    // Store the program so that the next runs don't have to compile it again
+    if (!cachePath.empty())
+        saveProgramBinary(cachePath, m_shaderProgram, sourceKey);
+
     // Force an OpenGL flush, so that the shader will appear updated
     // in all contexts immediately (solves problems in multi-threaded apps)
     glCheck(glFlush());
@@ -631,6 +967,23 @@ void Shader::bindTextures() const
 
     // Make sure that the texture unit which is left active is the number 0
     glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
+
+    // Bind the current texture
+    if (m_currentTexture != -1)
+        glCheck(GLEXT_glUniform1i(m_currentTexture, 0));
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 Shader::getTexturesCacheId() const
+{
+    // Combine the locations and the texture identifiers; texture
+    // identifiers are unique and change whenever a texture is modified
+    Uint64 id = static_cast<Uint64>(m_currentTexture + 1);
+    for (TextureTable::const_iterator it = m_textures.begin(); it != m_textures.end(); ++it)
+        id = (id * 31 + static_cast<Uint64>(it->first)) * 31 + priv::ResourceAccess::getCacheId(*it->second);
+
+    return id;
 }
 
 
@@ -657,6 +1010,53 @@ int Shader::getParamLocation(const std::string& name)
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void Shader::storeUniform(int handle, const float* values, unsigned int count)
+{
+    if ((handle < 0) || (static_cast<std::size_t>(handle) >= m_uniforms.size()))
+        return;
+
+    // Only flag the uniform if its value really changed
+    Uniform& uniform = m_uniforms[handle];
+    if ((uniform.count == count) && std::equal(values, values + count, uniform.values))
+        return;
+
+    std::copy(values, values + count, uniform.values);
+    uniform.count   = count;
+    uniform.dirty   = true;
+    m_uniformsDirty = true;
+    ++m_parametersId;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::uploadUniforms() const
+{
+    if (!m_uniformsDirty)
+        return;
+
+    for (UniformArray::iterator it = m_uniforms.begin(); it != m_uniforms.end(); ++it)
+    {
+        if (!it->dirty)
+            continue;
+
+        switch (it->count)
+        {
+            case 1:  glCheck(GLEXT_glUniform1f(it->location, it->values[0])); break;
+            case 2:  glCheck(GLEXT_glUniform2f(it->location, it->values[0], it->values[1])); break;
+            case 3:  glCheck(GLEXT_glUniform3f(it->location, it->values[0], it->values[1], it->values[2])); break;
+            case 4:  glCheck(GLEXT_glUniform4f(it->location, it->values[0], it->values[1], it->values[2], it->values[3])); break;
+            case 16: glCheck(GLEXT_glUniformMatrix4fv(it->location, 1, GL_FALSE, it->values)); break;
+            default: break;
+        }
+
+        it->dirty = false;
+    }
+
+    m_uniformsDirty = false;
+}
+
 } // namespace sf
 
 #else // SFML_OPENGL_ES
@@ -672,7 +1072,10 @@ Shader::CurrentTextureType Shader::CurrentTexture;
 ////////////////////////////////////////////////////////////
 Shader::Shader() :
 m_shaderProgram (0),
-m_currentTexture(-1)
+m_currentTexture(-1),
+m_uniformsDirty (false),
+m_cacheId       (0),
+m_parametersId  (0)
 {
 }
 
@@ -785,6 +1188,61 @@ void Shader::setParameter(const std::string& name, CurrentTextureType)
 }
 
 
+////////////////////////////////////////////////////////////
+int Shader::getUniformHandle(const std::string& name)
+{
+    return -1;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, float x)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, float x, float y)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, float x, float y, float z)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, float x, float y, float z, float w)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, const Vector2f& v)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, const Vector3f& v)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, const Color& color)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(int handle, const sf::Transform& transform)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
@@ -805,6 +1263,12 @@ bool Shader::isAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setBinaryCacheDirectory(const std::string& directory)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Shader::compile(const char* vertexShaderCode, const char* fragmentShaderCode)
 {
@@ -817,6 +1281,25 @@ void Shader::bindTextures() const
 {
 }
 
+
+////////////////////////////////////////////////////////////
+Uint64 Shader::getTexturesCacheId() const
+{
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::storeUniform(int handle, const float* values, unsigned int count)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::uploadUniforms() const
+{
+}
+
 } // namespace sf
 
 #endif // SFML_OPENGL_ES
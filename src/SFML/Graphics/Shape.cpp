@@ -131,7 +131,7 @@ const Color& Shape::getOutlineColor() const
 void Shape::setOutlineThickness(float thickness)
 {
     m_outlineThickness = thickness;
-    update(); // recompute everything because the whole shape must be offset
+    m_outlineNeedUpdate = true; // the fill is not affected, only the outline and the bounds
 }
 
 
@@ -145,6 +145,8 @@ float Shape::getOutlineThickness() const
 ////////////////////////////////////////////////////////////
 FloatRect Shape::getLocalBounds() const
 {
+    ensureOutlineUpdate();
+
     return m_bounds;
 }
 
@@ -158,15 +160,18 @@ FloatRect Shape::getGlobalBounds() const
 
 ////////////////////////////////////////////////////////////
 Shape::Shape() :
-m_texture         (NULL),
-m_textureRect     (),
-m_fillColor       (255, 255, 255),
-m_outlineColor    (255, 255, 255),
-m_outlineThickness(0),
-m_vertices        (TrianglesFan),
-m_outlineVertices (TrianglesStrip),
-m_insideBounds    (),
-m_bounds          ()
+m_texture          (NULL),
+m_textureRect      (),
+m_fillColor        (255, 255, 255),
+m_outlineColor     (255, 255, 255),
+m_outlineThickness (0),
+m_vertices         (TrianglesFan),
+m_outlineVertices  (TrianglesStrip),
+m_insideBounds     (),
+m_bounds           (),
+m_unitPoints       (NULL),
+m_geometryScale    (1, 1),
+m_outlineNeedUpdate(false)
 {
 }
 
@@ -180,6 +185,9 @@ void Shape::update()
     {
         m_vertices.resize(0);
         m_outlineVertices.resize(0);
+        m_unitPoints = NULL;
+        m_bounds = FloatRect();
+        m_outlineNeedUpdate = false;
         return;
     }
 
@@ -190,6 +198,65 @@ void Shape::update()
         m_vertices[i + 1].position = getPoint(i);
     m_vertices[count + 1].position = m_vertices[1].position;
 
+    // The points are in local coordinates already
+    m_unitPoints = NULL;
+    m_geometryScale = Vector2f(1, 1);
+
+    updateInside();
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::update(const Vector2f* points, std::size_t count, const Vector2f& scale)
+{
+    if (count < 3)
+    {
+        m_vertices.resize(0);
+        m_outlineVertices.resize(0);
+        m_unitPoints = NULL;
+        m_bounds = FloatRect();
+        m_outlineNeedUpdate = false;
+        return;
+    }
+
+    // A negative scale would mirror the texture coordinates, so in
+    // this case the points are scaled directly, like regular points
+    bool mirrored = (scale.x < 0) || (scale.y < 0);
+
+    // Same geometry as before: only the scale changed
+    if (!mirrored && (points == m_unitPoints) && (count + 2 == m_vertices.getVertexCount()))
+    {
+        m_geometryScale = scale;
+        m_outlineNeedUpdate = true;
+        return;
+    }
+
+    m_vertices.resize(count + 2); // + 2 for center and repeated first point
+
+    // Position
+    if (mirrored)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            m_vertices[i + 1].position = Vector2f(points[i].x * scale.x, points[i].y * scale.y);
+        m_unitPoints = NULL;
+        m_geometryScale = Vector2f(1, 1);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            m_vertices[i + 1].position = points[i];
+        m_unitPoints = points;
+        m_geometryScale = scale;
+    }
+    m_vertices[count + 1].position = m_vertices[1].position;
+
+    updateInside();
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::updateInside()
+{
     // Update the bounding rectangle
     m_vertices[0] = m_vertices[1]; // so that the result of getBounds() is correct
     m_insideBounds = m_vertices.getBounds();
@@ -204,8 +271,8 @@ void Shape::update()
     // Texture coordinates
     updateTexCoords();
 
-    // Outline
-    updateOutline();
+    // Outline, built on demand
+    m_outlineNeedUpdate = true;
 }
 
 
@@ -214,13 +281,17 @@ void Shape::draw(RenderTarget& target, RenderStates states) const
 {
     states.transform *= getTransform();
 
-    // Render the inside
-    states.texture = m_texture;
-    target.draw(m_vertices, states);
+    // Render the inside, with its size applied
+    RenderStates insideStates(states);
+    insideStates.transform.scale(m_geometryScale);
+    insideStates.texture = m_texture;
+    target.draw(m_vertices, insideStates);
 
     // Render the outline
     if (m_outlineThickness != 0)
     {
+        ensureOutlineUpdate();
+
         states.texture = NULL;
         target.draw(m_outlineVertices, states);
     }
@@ -249,19 +320,50 @@ void Shape::updateTexCoords()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutline()
+void Shape::ensureOutlineUpdate() const
+{
+    if (!m_outlineNeedUpdate)
+        return;
+
+    m_outlineNeedUpdate = false;
+
+    if (m_outlineThickness != 0)
+    {
+        // Visible outline: build it, it defines the bounds
+        updateOutline();
+    }
+    else
+    {
+        // No outline, the bounds are those of the inside
+        Transform scaling;
+        scaling.scale(m_geometryScale);
+        m_bounds = scaling.transformRect(m_insideBounds);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::updateOutline() const
 {
     std::size_t count = m_vertices.getVertexCount() - 2;
     m_outlineVertices.resize((count + 1) * 2);
 
+    // The outline is not scaled when rendered, so that its thickness
+    // is preserved: apply the scale of the fill to its points here
+    const Vector2f& scale = m_geometryScale;
+    Vector2f center(m_vertices[0].position.x * scale.x, m_vertices[0].position.y * scale.y);
+
     for (std::size_t i = 0; i < count; ++i)
     {
         std::size_t index = i + 1;
 
         // Get the two segments shared by the current point
-        Vector2f p0 = (i == 0) ? m_vertices[count].position : m_vertices[index - 1].position;
-        Vector2f p1 = m_vertices[index].position;
-        Vector2f p2 = m_vertices[index + 1].position;
+        const Vector2f& q0 = (i == 0) ? m_vertices[count].position : m_vertices[index - 1].position;
+        const Vector2f& q1 = m_vertices[index].position;
+        const Vector2f& q2 = m_vertices[index + 1].position;
+        Vector2f p0(q0.x * scale.x, q0.y * scale.y);
+        Vector2f p1(q1.x * scale.x, q1.y * scale.y);
+        Vector2f p2(q2.x * scale.x, q2.y * scale.y);
 
         // Compute their normal
         Vector2f n1 = computeNormal(p0, p1);
@@ -269,9 +371,9 @@ void Shape::updateOutline()
 
         // Make sure that the normals point towards the outside of the shape
         // (this depends on the order in which the points were defined)
-        if (dotProduct(n1, m_vertices[0].position - p1) > 0)
+        if (dotProduct(n1, center - p1) > 0)
             n1 = -n1;
-        if (dotProduct(n2, m_vertices[0].position - p1) > 0)
+        if (dotProduct(n2, center - p1) > 0)
             n2 = -n2;
 
         // Combine them to get the extrusion direction
@@ -296,8 +398,12 @@ void Shape::updateOutline()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutlineColors()
+void Shape::updateOutlineColors() const
 {
+    // Colors are assigned when the outline is built
+    if (m_outlineNeedUpdate)
+        return;
+
     for (std::size_t i = 0; i < m_outlineVertices.getVertexCount(); ++i)
         m_outlineVertices[i].color = m_outlineColor;
 }
@@ -0,0 +1,685 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/SoftwareRenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/ResourceAccess.hpp>
+#include <SFML/Graphics/PrimitiveList.hpp>
+#include <SFML/Graphics/ParallelFor.hpp>
+#include <SFML/Graphics/SSE.hpp>
+#include <SFML/System/Err.hpp>
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+    // Minimum number of rows that justifies an additional thread
+    const unsigned int minRowsPerThread = 32;
+
+    // Pixels being rendered
+    struct Surface
+    {
+        sf::Uint8*   pixels;
+        unsigned int width;
+    };
+
+    // Texture to sample
+    struct Sampler
+    {
+        const sf::Uint8* pixels;
+        int              width;
+        int              height;
+        bool             smooth;
+        bool             repeated;
+    };
+
+    // Bring a texel coordinate back into the texture
+    int wrap(int coordinate, int size, bool repeated)
+    {
+        if (repeated)
+        {
+            coordinate %= size;
+            return coordinate < 0 ? coordinate + size : coordinate;
+        }
+
+        return std::min(std::max(coordinate, 0), size - 1);
+    }
+
+    // Read a texel, as normalized components
+    void fetch(const Sampler& sampler, int x, int y, float* texel)
+    {
+        x = wrap(x, sampler.width, sampler.repeated);
+        y = wrap(y, sampler.height, sampler.repeated);
+
+        const sf::Uint8* pixel = sampler.pixels + (y * sampler.width + x) * 4;
+        for (int i = 0; i < 4; ++i)
+            texel[i] = pixel[i] / 255.f;
+    }
+
+    // Sample a texture at the given texture coordinates (in pixels)
+    void sample(const Sampler& sampler, float u, float v, float* texel)
+    {
+        if (!sampler.smooth)
+        {
+            fetch(sampler, static_cast<int>(std::floor(u)), static_cast<int>(std::floor(v)), texel);
+            return;
+        }
+
+        // Bilinear filtering, between the centers of the 4 nearest texels
+        float x  = u - 0.5f;
+        float y  = v - 0.5f;
+        int   x0 = static_cast<int>(std::floor(x));
+        int   y0 = static_cast<int>(std::floor(y));
+        float fx = x - x0;
+        float fy = y - y0;
+
+        float texels[4][4];
+        fetch(sampler, x0,     y0,     texels[0]);
+        fetch(sampler, x0 + 1, y0,     texels[1]);
+        fetch(sampler, x0,     y0 + 1, texels[2]);
+        fetch(sampler, x0 + 1, y0 + 1, texels[3]);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            float top    = texels[0][i] + (texels[1][i] - texels[0][i]) * fx;
+            float bottom = texels[2][i] + (texels[3][i] - texels[2][i]) * fx;
+            texel[i] = top + (bottom - top) * fy;
+        }
+    }
+
+    // Compute a blending factor for one component
+    float factor(sf::BlendMode::Factor blendFactor, float source, float sourceAlpha, float destination, float destinationAlpha)
+    {
+        switch (blendFactor)
+        {
+            default:
+            case sf::BlendMode::Zero:             return 0.f;
+            case sf::BlendMode::One:              return 1.f;
+            case sf::BlendMode::SrcColor:         return source;
+            case sf::BlendMode::OneMinusSrcColor: return 1.f - source;
+            case sf::BlendMode::DstColor:         return destination;
+            case sf::BlendMode::OneMinusDstColor: return 1.f - destination;
+            case sf::BlendMode::SrcAlpha:         return sourceAlpha;
+            case sf::BlendMode::OneMinusSrcAlpha: return 1.f - sourceAlpha;
+            case sf::BlendMode::DstAlpha:         return destinationAlpha;
+            case sf::BlendMode::OneMinusDstAlpha: return 1.f - destinationAlpha;
+        }
+    }
+
+    // Combine a source and a destination component
+    float combine(sf::BlendMode::Equation equation, float source, float sourceFactor, float destination, float destinationFactor)
+    {
+        float result = (equation == sf::BlendMode::Add) ? source * sourceFactor + destination * destinationFactor
+                                                        : source * sourceFactor - destination * destinationFactor;
+
+        return std::min(std::max(result, 0.f), 1.f);
+    }
+
+    // Blend a fragment into a pixel
+    void blend(sf::Uint8* pixel, const float* color, const sf::BlendMode& mode)
+    {
+        float destination[4];
+        for (int i = 0; i < 4; ++i)
+            destination[i] = pixel[i] / 255.f;
+
+        float result[4];
+        for (int i = 0; i < 3; ++i)
+        {
+            float sourceFactor      = factor(mode.colorSrcFactor, color[i], color[3], destination[i], destination[3]);
+            float destinationFactor = factor(mode.colorDstFactor, color[i], color[3], destination[i], destination[3]);
+            result[i] = combine(mode.colorEquation, color[i], sourceFactor, destination[i], destinationFactor);
+        }
+
+        float sourceFactor      = factor(mode.alphaSrcFactor, color[3], color[3], destination[3], destination[3]);
+        float destinationFactor = factor(mode.alphaDstFactor, color[3], color[3], destination[3], destination[3]);
+        result[3] = combine(mode.alphaEquation, color[3], sourceFactor, destination[3], destinationFactor);
+
+        for (int i = 0; i < 4; ++i)
+            pixel[i] = static_cast<sf::Uint8>(result[i] * 255.f + 0.5f);
+    }
+
+    // Compute the color of a fragment from the weights of the vertices of its primitive, and write it
+    void shade(const Surface& surface, int x, int y, const sf::Vertex* const* vertices, const float* weights, int count,
+               const Sampler& sampler, const sf::BlendMode& mode)
+    {
+        float color[4] = {0.f, 0.f, 0.f, 0.f};
+        float u = 0.f;
+        float v = 0.f;
+        for (int i = 0; i < count; ++i)
+        {
+            const sf::Vertex& vertex = *vertices[i];
+            color[0] += vertex.color.r * weights[i];
+            color[1] += vertex.color.g * weights[i];
+            color[2] += vertex.color.b * weights[i];
+            color[3] += vertex.color.a * weights[i];
+            u += vertex.texCoords.x * weights[i];
+            v += vertex.texCoords.y * weights[i];
+        }
+
+        for (int i = 0; i < 4; ++i)
+            color[i] /= 255.f;
+
+        // Modulate the color with the texture, like the fixed pipeline does
+        if (sampler.pixels)
+        {
+            float texel[4];
+            sample(sampler, u, v, texel);
+            for (int i = 0; i < 4; ++i)
+                color[i] *= texel[i];
+        }
+
+        blend(surface.pixels + (y * surface.width + x) * 4, color, mode);
+    }
+
+    // Rasterize a triangle, with the OpenGL conventions (pixel centers, top-left rule)
+    void rasterizeTriangle(const sf::Vertex& a, const sf::Vertex& b, const sf::Vertex& c, const Surface& surface,
+                           const sf::IntRect& clip, const Sampler& sampler, const sf::BlendMode& mode)
+    {
+        const sf::Vertex* vertices[3] = {&a, &b, &c};
+
+        // Make the triangle counter-clockwise (in the y-down pixel space), skip degenerate ones
+        const sf::Vector2f& p0 = a.position;
+        float area = (b.position.x - p0.x) * (c.position.y - p0.y) - (b.position.y - p0.y) * (c.position.x - p0.x);
+        if (!(area != 0.f))
+            return;
+        if (area < 0.f)
+        {
+            std::swap(vertices[1], vertices[2]);
+            area = -area;
+        }
+
+        // Bounding box of the triangle
+        float minX = std::min(std::min(a.position.x, b.position.x), c.position.x);
+        float minY = std::min(std::min(a.position.y, b.position.y), c.position.y);
+        float maxX = std::max(std::max(a.position.x, b.position.x), c.position.x);
+        float maxY = std::max(std::max(a.position.y, b.position.y), c.position.y);
+
+        // Skip the triangles outside the clipping rectangle while the bounds are still floats
+        float clipLeft   = static_cast<float>(clip.left);
+        float clipTop    = static_cast<float>(clip.top);
+        float clipRight  = static_cast<float>(clip.left + clip.width);
+        float clipBottom = static_cast<float>(clip.top + clip.height);
+        if (!((minX < clipRight) && (maxX > clipLeft) && (minY < clipBottom) && (maxY > clipTop)))
+            return;
+
+        // Restrict the bounding box to the clipping rectangle
+        int left   = static_cast<int>(std::max(std::floor(minX), clipLeft));
+        int top    = static_cast<int>(std::max(std::floor(minY), clipTop));
+        int right  = static_cast<int>(std::min(std::ceil(maxX), clipRight));
+        int bottom = static_cast<int>(std::min(std::ceil(maxY), clipBottom));
+        if ((left >= right) || (top >= bottom))
+            return;
+
+        // Edge functions E(x, y) = A * x + B * y + C; the one of the edge
+        // opposite to a vertex, divided by the area, is the weight of this vertex
+        float A[3], B[3], C[3];
+        bool topLeft[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            const sf::Vector2f& from = vertices[(i + 1) % 3]->position;
+            const sf::Vector2f& to   = vertices[(i + 2) % 3]->position;
+            A[i] = from.y - to.y;
+            B[i] = to.x - from.x;
+            C[i] = (to.y - from.y) * from.x - (to.x - from.x) * from.y;
+            topLeft[i] = (to.y < from.y) || ((to.y == from.y) && (to.x > from.x));
+        }
+
+        float invArea = 1.f / area;
+
+        for (int y = top; y < bottom; ++y)
+        {
+            float py = y + 0.5f;
+            float rowE[3];
+            for (int i = 0; i < 3; ++i)
+                rowE[i] = B[i] * py + C[i];
+
+            int x = left;
+
+#ifdef SFML_SSE
+
+            // Test the coverage of 4 pixels at once
+            const __m128 zero    = _mm_setzero_ps();
+            const __m128 centers = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+
+            for (; x + 4 <= right; x += 4)
+            {
+                __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), centers);
+
+                float e[3][4];
+                int mask = 0xF;
+                for (int i = 0; i < 3; ++i)
+                {
+                    __m128 edge = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(A[i]), px), _mm_set1_ps(rowE[i]));
+                    __m128 inside = _mm_cmpgt_ps(edge, zero);
+                    if (topLeft[i])
+                        inside = _mm_or_ps(inside, _mm_cmpeq_ps(edge, zero));
+
+                    mask &= _mm_movemask_ps(inside);
+                    _mm_storeu_ps(e[i], edge);
+                }
+
+                for (int lane = 0; mask != 0; ++lane, mask >>= 1)
+                {
+                    if (mask & 1)
+                    {
+                        float weights[3] = {e[0][lane] * invArea, e[1][lane] * invArea, e[2][lane] * invArea};
+                        shade(surface, x + lane, y, vertices, weights, 3, sampler, mode);
+                    }
+                }
+            }
+
+#endif
+
+            // Remaining pixels (or all of them without SSE)
+            for (; x < right; ++x)
+            {
+                float px = x + 0.5f;
+
+                float e[3];
+                bool inside = true;
+                for (int i = 0; i < 3; ++i)
+                {
+                    e[i] = A[i] * px + rowE[i];
+                    if (!((e[i] > 0.f) || ((e[i] == 0.f) && topLeft[i])))
+                        inside = false;
+                }
+
+                if (inside)
+                {
+                    float weights[3] = {e[0] * invArea, e[1] * invArea, e[2] * invArea};
+                    shade(surface, x, y, vertices, weights, 3, sampler, mode);
+                }
+            }
+        }
+    }
+
+    // Restrict the parameter range [t0, t1] of a segment to one side of a boundary (Liang-Barsky)
+    bool clipSegment(double p, double q, double& t0, double& t1)
+    {
+        // Parallel to the boundary: entirely inside or entirely outside
+        if (p == 0.0)
+            return q >= 0.0;
+
+        double t = q / p;
+        if (p < 0.0)
+        {
+            if (t > t1)
+                return false;
+            t0 = std::max(t0, t);
+        }
+        else
+        {
+            if (t < t0)
+                return false;
+            t1 = std::min(t1, t);
+        }
+
+        return true;
+    }
+
+    // Rasterize a line, one pixel per step along its major axis
+    void rasterizeLine(const sf::Vertex& a, const sf::Vertex& b, const Surface& surface,
+                       const sf::IntRect& clip, const Sampler& sampler, const sf::BlendMode& mode)
+    {
+        const sf::Vertex* vertices[2] = {&a, &b};
+
+        double dx = static_cast<double>(b.position.x) - a.position.x;
+        double dy = static_cast<double>(b.position.y) - a.position.y;
+
+        // Keep only the part of the line inside the clipping rectangle, so that the
+        // steps outside of it are neither walked nor converted to integer coordinates
+        double clipLeft   = clip.left;
+        double clipTop    = clip.top;
+        double clipRight  = clip.left + clip.width;
+        double clipBottom = clip.top + clip.height;
+        double t0 = 0.0;
+        double t1 = 1.0;
+        if (!clipSegment(-dx, a.position.x - clipLeft,   t0, t1) ||
+            !clipSegment( dx, clipRight - a.position.x,  t0, t1) ||
+            !clipSegment(-dy, a.position.y - clipTop,    t0, t1) ||
+            !clipSegment( dy, clipBottom - a.position.y, t0, t1) ||
+            !(t0 <= t1))
+            return;
+
+        // Steps of the whole line which fall in the visible part, so that every band
+        // draws the same pixels; their number is bounded by the size of the rectangle
+        double steps = std::floor(std::max(std::fabs(dx), std::fabs(dy)));
+        double first = std::ceil(t0 * steps);
+        double last  = std::floor(t1 * steps);
+        if (!(last - first <= std::max(clipRight - clipLeft, clipBottom - clipTop) + 1.0))
+            return;
+        int count = static_cast<int>(last - first);
+        double stepX = (steps > 0.0) ? dx / steps : 0.0;
+        double stepY = (steps > 0.0) ? dy / steps : 0.0;
+
+        for (int i = 0; i <= count; ++i)
+        {
+            double step = first + i;
+            double t = (steps > 0.0) ? step / steps : 0.0;
+            double x = std::floor(a.position.x + stepX * step);
+            double y = std::floor(a.position.y + stepY * step);
+
+            // The rounding may still place the ends of the visible part just outside
+            if ((x >= clipLeft) && (x < clipRight) && (y >= clipTop) && (y < clipBottom))
+            {
+                float weights[2] = {static_cast<float>(1.0 - t), static_cast<float>(t)};
+                shade(surface, static_cast<int>(x), static_cast<int>(y), vertices, weights, 2, sampler, mode);
+            }
+        }
+    }
+
+    // Rasterize a point, as a single pixel
+    void rasterizePoint(const sf::Vertex& point, const Surface& surface,
+                        const sf::IntRect& clip, const Sampler& sampler, const sf::BlendMode& mode)
+    {
+        const sf::Vertex* vertices[1] = {&point};
+
+        // Reject the points outside the clipping rectangle before converting them to integers
+        float x = std::floor(point.position.x);
+        float y = std::floor(point.position.y);
+        if ((x >= static_cast<float>(clip.left)) && (x < static_cast<float>(clip.left + clip.width)) &&
+            (y >= static_cast<float>(clip.top))  && (y < static_cast<float>(clip.top + clip.height)))
+        {
+            float weights[1] = {1.f};
+            shade(surface, static_cast<int>(x), static_cast<int>(y), vertices, weights, 1, sampler, mode);
+        }
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Band of rows rasterized by a thread
+///
+////////////////////////////////////////////////////////////
+struct SoftwareRenderTarget::RasterTask
+{
+    void run()
+    {
+        target->rasterize(top, bottom);
+    }
+
+    SoftwareRenderTarget* target;
+    unsigned int          top;
+    unsigned int          bottom;
+};
+
+
+////////////////////////////////////////////////////////////
+SoftwareRenderTarget::SoftwareRenderTarget() :
+m_size       (0, 0),
+m_threadCount(1),
+m_pixels     (),
+m_commands   (),
+m_vertices   (),
+m_textures   (),
+m_image      ()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoftwareRenderTarget::create(unsigned int width, unsigned int height)
+{
+    if ((width == 0) || (height == 0))
+    {
+        err() << "Failed to create software render target, invalid size (" << width << "x" << height << ")" << std::endl;
+        return false;
+    }
+
+    m_size = Vector2u(width, height);
+    m_pixels.assign(width * height * 4, 0);
+    m_commands.clear();
+    m_vertices.clear();
+    m_textures.clear();
+    m_image.create(width, height, Color(0, 0, 0, 0));
+
+    // Setup the default view
+    RenderTarget::initialize();
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u SoftwareRenderTarget::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::setThreadCount(unsigned int count)
+{
+    m_threadCount = std::max(count, 1u);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SoftwareRenderTarget::getThreadCount() const
+{
+    return m_threadCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::clear(const Color& color)
+{
+    // Everything drawn so far would be covered anyway
+    m_commands.clear();
+    m_vertices.clear();
+
+    for (std::size_t i = 0; i < m_pixels.size(); i += 4)
+    {
+        m_pixels[i + 0] = color.r;
+        m_pixels[i + 1] = color.g;
+        m_pixels[i + 2] = color.b;
+        m_pixels[i + 3] = color.a;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
+                                PrimitiveType type, const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0) || m_pixels.empty())
+        return;
+
+    Command command;
+    command.texture    = NULL;
+    command.isSmooth   = false;
+    command.isRepeated = false;
+    command.blendMode  = states.blendMode;
+
+    // Get an up-to-date copy of the texture
+    if (states.texture && (states.texture->getSize().x > 0) && (states.texture->getSize().y > 0))
+    {
+        TextureCopy& copy = m_textures[states.texture];
+        Uint64 cacheId = priv::ResourceAccess::getCacheId(*states.texture);
+        if (copy.cacheId != cacheId)
+        {
+            // The pending draws may use the previous contents
+            if (copy.used)
+                display();
+
+            copy.image   = states.texture->copyToImage();
+            copy.cacheId = cacheId;
+        }
+
+        copy.used          = true;
+        command.texture    = &copy;
+        command.isSmooth   = states.texture->isSmooth();
+        command.isRepeated = states.texture->isRepeated();
+    }
+
+    // Compute the viewport, and the part of it which is inside the target
+    IntRect viewport = getViewport(getView());
+    if (!viewport.intersects(IntRect(0, 0, m_size.x, m_size.y), command.clip))
+        return;
+
+    // Transform the vertices to pixel coordinates: model, view, then viewport
+    Transform toPixels(viewport.width / 2.f, 0.f,                    viewport.left + viewport.width / 2.f,
+                       0.f,                  -viewport.height / 2.f, viewport.top + viewport.height / 2.f,
+                       0.f,                  0.f,                    1.f);
+    toPixels *= getView().getTransform();
+    toPixels *= states.transform;
+
+    command.first = m_vertices.size();
+    command.type  = priv::appendPrimitives(m_vertices, vertices, vertexCount, type, toPixels);
+    command.count = m_vertices.size() - command.first;
+    if (command.count > 0)
+        m_commands.push_back(command);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::display()
+{
+    if (m_pixels.empty())
+        return;
+
+    if (!m_commands.empty())
+    {
+        // Split the target into bands of rows, if it's worth it
+        unsigned int threadCount = std::min(m_threadCount, std::max(m_size.y / minRowsPerThread, 1u));
+
+        std::vector<RasterTask> tasks(threadCount);
+        for (unsigned int i = 0; i < threadCount; ++i)
+        {
+            tasks[i].target = this;
+            tasks[i].top    = m_size.y * i / threadCount;
+            tasks[i].bottom = m_size.y * (i + 1) / threadCount;
+        }
+
+        // Render the bands in parallel, the first one in this thread
+        priv::parallelFor(tasks);
+
+        m_commands.clear();
+        m_vertices.clear();
+    }
+
+    // Forget the textures which are no longer used
+    for (TextureTable::iterator it = m_textures.begin(); it != m_textures.end();)
+    {
+        if (it->second.used)
+        {
+            it->second.used = false;
+            ++it;
+        }
+        else
+        {
+            m_textures.erase(it++);
+        }
+    }
+
+    m_image.create(m_size.x, m_size.y, &m_pixels[0]);
+}
+
+
+////////////////////////////////////////////////////////////
+const Image& SoftwareRenderTarget::getImage() const
+{
+    return m_image;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoftwareRenderTarget::activate(bool)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::rasterize(unsigned int top, unsigned int bottom)
+{
+    Surface surface = {&m_pixels[0], m_size.x};
+
+    for (std::vector<Command>::const_iterator it = m_commands.begin(); it != m_commands.end(); ++it)
+    {
+        const Command& command = *it;
+
+        // Restrict the clipping rectangle to the band
+        int clipTop    = std::max(command.clip.top, static_cast<int>(top));
+        int clipBottom = std::min(command.clip.top + command.clip.height, static_cast<int>(bottom));
+        if (clipTop >= clipBottom)
+            continue;
+        IntRect clip(command.clip.left, clipTop, command.clip.width, clipBottom - clipTop);
+
+        Sampler sampler = {NULL, 0, 0, command.isSmooth, command.isRepeated};
+        if (command.texture)
+        {
+            sampler.pixels = command.texture->image.getPixelsPtr();
+            sampler.width  = static_cast<int>(command.texture->image.getSize().x);
+            sampler.height = static_cast<int>(command.texture->image.getSize().y);
+        }
+
+        const Vertex* vertices = &m_vertices[command.first];
+        const BlendMode& mode = command.blendMode;
+
+        switch (command.type)
+        {
+            case Triangles:
+            {
+                for (std::size_t i = 0; i + 3 <= command.count; i += 3)
+                    rasterizeTriangle(vertices[i], vertices[i + 1], vertices[i + 2], surface, clip, sampler, mode);
+                break;
+            }
+
+            case Quads:
+            {
+                for (std::size_t i = 0; i + 4 <= command.count; i += 4)
+                {
+                    rasterizeTriangle(vertices[i], vertices[i + 1], vertices[i + 2], surface, clip, sampler, mode);
+                    rasterizeTriangle(vertices[i], vertices[i + 2], vertices[i + 3], surface, clip, sampler, mode);
+                }
+                break;
+            }
+
+            case Lines:
+            {
+                for (std::size_t i = 0; i + 2 <= command.count; i += 2)
+                    rasterizeLine(vertices[i], vertices[i + 1], surface, clip, sampler, mode);
+                break;
+            }
+
+            default:
+            {
+                for (std::size_t i = 0; i < command.count; ++i)
+                    rasterizePoint(vertices[i], surface, clip, sampler, mode);
+                break;
+            }
+        }
+    }
+}
+
+} // namespace sf
@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureArray.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <cstdlib>
 
@@ -72,6 +73,14 @@ void Sprite::setTexture(const Texture& texture, bool resetRect)
 }
 
 
+////////////////////////////////////////////////////////////
+void Sprite::setTexture(const TextureArray& textures, unsigned int layer)
+{
+    m_texture = &textures.getTexture();
+    setTextureRect(textures.getLayerRect(layer));
+}
+
+
 ////////////////////////////////////////////////////////////
 void Sprite::setTextureRect(const IntRect& rectangle)
 {
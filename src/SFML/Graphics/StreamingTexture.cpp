@@ -0,0 +1,313 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/StreamingTexture.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ResourceAccess.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/TextureSaver.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Err.hpp>
+#include <algorithm>
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+StreamingTexture::StreamingTexture() :
+m_size          (0, 0),
+m_writeFrame    (0),
+m_readyFrame    (1),
+m_readFrame     (2),
+m_hasNewFrame   (false),
+m_currentTexture(0),
+m_droppedCount  (0)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        // The textures are rewritten every frame, evicting them would be pointless
+        priv::ResourceAccess::setEvictable(m_textures[i], false);
+        m_pixelBuffers[i] = 0;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+StreamingTexture::~StreamingTexture()
+{
+    destroyPixelBuffers();
+}
+
+
+////////////////////////////////////////////////////////////
+bool StreamingTexture::create(unsigned int width, unsigned int height)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        if (!m_textures[i].create(width, height))
+        {
+            err() << "Failed to create streaming texture" << std::endl;
+            return false;
+        }
+    }
+
+    // Start with transparent black frames
+    for (int i = 0; i < 3; ++i)
+    {
+        m_frames[i].assign(width * height * 4, 0);
+        m_textures[i].update(&m_frames[i][0]);
+    }
+
+    {
+        Lock lock(m_mutex);
+
+        m_size           = Vector2u(width, height);
+        m_writeFrame     = 0;
+        m_readyFrame     = 1;
+        m_readFrame      = 2;
+        m_hasNewFrame    = false;
+        m_currentTexture = 0;
+        m_droppedCount   = 0;
+    }
+
+    // Create the pixel buffer objects, if they are supported
+    destroyPixelBuffers();
+
+#ifndef SFML_OPENGL_ES
+
+    ensureGlContext();
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    if (GLEXT_pixel_buffer_object)
+    {
+        GLuint buffers[3];
+        glCheck(GLEXT_glGenBuffers(3, buffers));
+        for (int i = 0; i < 3; ++i)
+            m_pixelBuffers[i] = static_cast<unsigned int>(buffers[i]);
+    }
+
+#endif
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u StreamingTexture::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+Uint8* StreamingTexture::beginFrame()
+{
+    // Only the producer changes the index of the frame that it writes
+    std::vector<Uint8>& frame = m_frames[m_writeFrame];
+
+    return frame.empty() ? NULL : &frame[0];
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamingTexture::endFrame()
+{
+    // Nothing to publish if the texture was not created
+    if (m_frames[m_writeFrame].empty())
+        return;
+
+    Lock lock(m_mutex);
+
+    // The written frame becomes the ready one, the previous ready one is recycled
+    std::swap(m_writeFrame, m_readyFrame);
+
+    if (m_hasNewFrame)
+        m_droppedCount++;
+    m_hasNewFrame = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamingTexture::submitFrame(const Uint8* pixels)
+{
+    Uint8* frame = beginFrame();
+    if (pixels && frame)
+    {
+        std::memcpy(frame, pixels, m_frames[m_writeFrame].size());
+        endFrame();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamingTexture::submitFrame(const Image& image)
+{
+    if (image.getSize() != m_size)
+    {
+        err() << "Failed to submit frame to streaming texture, the image size (" << image.getSize().x << "x" << image.getSize().y
+              << ") doesn't match the texture size (" << m_size.x << "x" << m_size.y << ")" << std::endl;
+        return;
+    }
+
+    submitFrame(image.getPixelsPtr());
+}
+
+
+////////////////////////////////////////////////////////////
+bool StreamingTexture::present()
+{
+    {
+        Lock lock(m_mutex);
+
+        if (!m_hasNewFrame)
+            return false;
+
+        // Take the most recent complete frame, and give ours back to the producer
+        std::swap(m_readFrame, m_readyFrame);
+        m_hasNewFrame = false;
+    }
+
+    // Upload to the texture which was presented the longest time ago,
+    // pending draw calls may still read the two others
+    unsigned int next = (m_currentTexture + 1) % 3;
+    upload(next, &m_frames[m_readFrame][0]);
+    m_currentTexture = next;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& StreamingTexture::getTexture() const
+{
+    return m_textures[m_currentTexture];
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamingTexture::setSmooth(bool smooth)
+{
+    for (int i = 0; i < 3; ++i)
+        m_textures[i].setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool StreamingTexture::isSmooth() const
+{
+    return m_textures[0].isSmooth();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int StreamingTexture::getDroppedFrameCount() const
+{
+    Lock lock(m_mutex);
+
+    return m_droppedCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamingTexture::destroyPixelBuffers()
+{
+#ifndef SFML_OPENGL_ES
+
+    if (m_pixelBuffers[0])
+    {
+        ensureGlContext();
+
+        GLuint buffers[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            buffers[i] = static_cast<GLuint>(m_pixelBuffers[i]);
+            m_pixelBuffers[i] = 0;
+        }
+        glCheck(GLEXT_glDeleteBuffers(3, buffers));
+    }
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamingTexture::upload(unsigned int index, const Uint8* pixels)
+{
+    Texture& texture = m_textures[index];
+
+#ifndef SFML_OPENGL_ES
+
+    if (m_pixelBuffers[index])
+    {
+        ensureGlContext();
+
+        // Make sure that the current texture binding will be preserved
+        priv::TextureSaver save;
+
+        GLsizeiptrARB size = static_cast<GLsizeiptrARB>(m_frames[m_readFrame].size());
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, m_pixelBuffers[index]));
+
+        // Orphan the previous storage of the buffer, so that mapping it doesn't
+        // wait for the transfer of the previous frame to finish
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_UNPACK_BUFFER, size, NULL, GLEXT_GL_STREAM_DRAW));
+
+        bool uploaded = false;
+        void* destination = GLEXT_glMapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, GLEXT_GL_WRITE_ONLY);
+        if (destination)
+        {
+            std::memcpy(destination, pixels, static_cast<std::size_t>(size));
+
+            // The buffer contents can be lost (i.e. on a video mode change), in this case it must not be used
+            if (GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER))
+            {
+                // The pixels are read from the bound buffer, the transfer is asynchronous
+                glCheck(glBindTexture(GL_TEXTURE_2D, priv::ResourceAccess::getHandle(texture)));
+                glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_size.x, m_size.y, GL_RGBA, GL_UNSIGNED_BYTE, NULL));
+                uploaded = true;
+            }
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+
+        if (uploaded)
+        {
+            priv::ResourceAccess::markAsModified(texture);
+            return;
+        }
+    }
+
+#endif
+
+    // Synchronous upload from system memory
+    texture.update(pixels);
+}
+
+} // namespace sf
@@ -28,9 +28,73 @@
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
 #include <cmath>
 
 
+namespace
+{
+    // Add an underline or strikethrough line to the vertex array
+    void addLine(sf::VertexArray& vertices, float left, float right, float baseline, const sf::Color& color, float offset, float thickness)
+    {
+        float top = std::floor(baseline + offset - (thickness / 2) + 0.5f);
+        float bottom = top + std::floor(thickness + 0.5f);
+
+        vertices.append(sf::Vertex(sf::Vector2f(left,  top),    color, sf::Vector2f(1, 1)));
+        vertices.append(sf::Vertex(sf::Vector2f(right, top),    color, sf::Vector2f(1, 1)));
+        vertices.append(sf::Vertex(sf::Vector2f(left,  bottom), color, sf::Vector2f(1, 1)));
+        vertices.append(sf::Vertex(sf::Vector2f(left,  bottom), color, sf::Vector2f(1, 1)));
+        vertices.append(sf::Vertex(sf::Vector2f(right, top),    color, sf::Vector2f(1, 1)));
+        vertices.append(sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(1, 1)));
+    }
+
+    // Split a pen position into a pixel position and a subpixel phase (in quarters of pixel)
+    unsigned int splitSubpixel(float& x)
+    {
+        float pixel = std::floor(x);
+        unsigned int phase = static_cast<unsigned int>((x - pixel) * 4.f + 0.5f);
+        if (phase == 4)
+        {
+            pixel += 1.f;
+            phase = 0;
+        }
+
+        x = pixel;
+        return phase;
+    }
+
+    // Add a glyph quad to the vertex array, and extend the bounds to contain it
+    void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, const sf::Color& color, const sf::Glyph& glyph, float italic,
+                      float& minX, float& minY, float& maxX, float& maxY)
+    {
+        float left   = glyph.bounds.left;
+        float top    = glyph.bounds.top;
+        float right  = glyph.bounds.left + glyph.bounds.width;
+        float bottom = glyph.bounds.top  + glyph.bounds.height;
+
+        float u1 = static_cast<float>(glyph.textureRect.left);
+        float v1 = static_cast<float>(glyph.textureRect.top);
+        float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
+        float v2 = static_cast<float>(glyph.textureRect.top  + glyph.textureRect.height);
+
+        float x = position.x;
+        float y = position.y;
+
+        vertices.append(sf::Vertex(sf::Vector2f(x + left  - italic * top,    y + top),    color, sf::Vector2f(u1, v1)));
+        vertices.append(sf::Vertex(sf::Vector2f(x + right - italic * top,    y + top),    color, sf::Vector2f(u2, v1)));
+        vertices.append(sf::Vertex(sf::Vector2f(x + left  - italic * bottom, y + bottom), color, sf::Vector2f(u1, v2)));
+        vertices.append(sf::Vertex(sf::Vector2f(x + left  - italic * bottom, y + bottom), color, sf::Vector2f(u1, v2)));
+        vertices.append(sf::Vertex(sf::Vector2f(x + right - italic * top,    y + top),    color, sf::Vector2f(u2, v1)));
+        vertices.append(sf::Vertex(sf::Vector2f(x + right - italic * bottom, y + bottom), color, sf::Vector2f(u2, v2)));
+
+        minX = std::min(minX, x + left - italic * bottom);
+        maxX = std::max(maxX, x + right - italic * top);
+        minY = std::min(minY, y + top);
+        maxY = std::max(maxY, y + bottom);
+    }
+}
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -40,8 +104,14 @@ m_font              (NULL),
 m_characterSize     (30),
 m_style             (Regular),
 m_color             (255, 255, 255),
+m_maxWidth          (0.f),
+m_alignment         (Left),
 m_vertices          (Triangles),
 m_bounds            (),
+m_characterPositions(),
+m_lines             (),
+m_glyphs            (),
+m_advances          (),
 m_geometryNeedUpdate(false)
 {
 
@@ -55,8 +125,14 @@ m_font              (&font),
 m_characterSize     (characterSize),
 m_style             (Regular),
 m_color             (255, 255, 255),
+m_maxWidth          (0.f),
+m_alignment         (Left),
 m_vertices          (Triangles),
 m_bounds            (),
+m_characterPositions(),
+m_lines             (),
+m_glyphs            (),
+m_advances          (),
 m_geometryNeedUpdate(true)
 {
 
@@ -125,6 +201,28 @@ void Text::setColor(const Color& color)
 }
 
 
+////////////////////////////////////////////////////////////
+void Text::setMaxWidth(float maxWidth)
+{
+    if (m_maxWidth != maxWidth)
+    {
+        m_maxWidth = maxWidth;
+        m_geometryNeedUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::setAlignment(Alignment alignment)
+{
+    if (m_alignment != alignment)
+    {
+        m_alignment = alignment;
+        m_geometryNeedUpdate = true;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 const String& Text::getString() const
 {
@@ -160,6 +258,20 @@ const Color& Text::getColor() const
 }
 
 
+////////////////////////////////////////////////////////////
+float Text::getMaxWidth() const
+{
+    return m_maxWidth;
+}
+
+
+////////////////////////////////////////////////////////////
+Text::Alignment Text::getAlignment() const
+{
+    return m_alignment;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2f Text::findCharacterPos(std::size_t index) const
 {
@@ -167,42 +279,98 @@ Vector2f Text::findCharacterPos(std::size_t index) const
     if (!m_font)
         return Vector2f();
 
+    // Make sure that the character positions are up to date
+    ensureGeometryUpdate();
+
     // Adjust the index if it's out of range
     if (index > m_string.getSize())
         index = m_string.getSize();
 
-    // Precompute the variables needed by the algorithm
-    bool  bold   = (m_style & Bold) != 0;
-    float hspace = static_cast<float>(m_font->getGlyph(L' ', m_characterSize, bold).advance);
-    float vspace = static_cast<float>(m_font->getLineSpacing(m_characterSize));
+    // Transform the position to global coordinates
+    return getTransform().transformPoint(m_characterPositions[index]);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Text::findCharacterIndex(const Vector2f& point) const
+{
+    ensureGeometryUpdate();
+
+    // No font: no layout
+    if (m_lines.empty())
+        return 0;
+
+    // Transform the point to local coordinates
+    Vector2f position = getInverseTransform().transformPoint(point);
 
-    // Compute the position
-    Vector2f position;
-    Uint32 prevChar = 0;
-    for (std::size_t i = 0; i < index; ++i)
+    // Find the line under the point (lines are sorted vertically)
+    std::size_t first = 0;
+    std::size_t last  = m_lines.size();
+    while (last - first > 1)
     {
-        Uint32 curChar = m_string[i];
+        std::size_t middle = (first + last) / 2;
+        if (m_lines[middle].top <= position.y)
+            first = middle;
+        else
+            last = middle;
+    }
+    const Line& line = m_lines[first];
 
-        // Apply the kerning offset
-        position.x += static_cast<float>(m_font->getKerning(prevChar, curChar, m_characterSize));
-        prevChar = curChar;
+    // Find the character under the point (characters are sorted horizontally within a line);
+    // the last line also contains the end of the string
+    first = line.begin;
+    last  = (line.end == m_string.getSize()) ? line.end + 1 : line.end;
+    if (!line.rightToLeft)
+    {
+        while (last - first > 1)
+        {
+            std::size_t middle = (first + last) / 2;
+            if (m_characterPositions[middle].x <= position.x)
+                first = middle;
+            else
+                last = middle;
+        }
 
-        // Handle special characters
-        switch (curChar)
+        return first;
+    }
+    else
+    {
+        // Positions decrease along right-to-left lines: find the first character on the left of the point
+        std::size_t end = last;
+        while (first < last)
         {
-            case ' ':  position.x += hspace;                 continue;
-            case '\t': position.x += hspace * 4;             continue;
-            case '\n': position.y += vspace; position.x = 0; continue;
+            std::size_t middle = (first + last) / 2;
+            if (m_characterPositions[middle].x <= position.x)
+                last = middle;
+            else
+                first = middle + 1;
         }
 
-        // For regular characters, add the advance offset of the glyph
-        position.x += static_cast<float>(m_font->getGlyph(curChar, m_characterSize, bold).advance);
+        return std::min(first, end - 1);
     }
+}
 
-    // Transform the position to global coordinates
-    position = getTransform().transformPoint(position);
 
-    return position;
+////////////////////////////////////////////////////////////
+std::size_t Text::getLineCount() const
+{
+    ensureGeometryUpdate();
+
+    return m_lines.size();
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect Text::getLineBounds(std::size_t line) const
+{
+    ensureGeometryUpdate();
+
+    if (line >= m_lines.size())
+        return FloatRect();
+
+    float height = static_cast<float>(m_font->getLineSpacing(m_characterSize));
+
+    return FloatRect(m_lines[line].left, m_lines[line].top, m_lines[line].width, height);
 }
 
 
@@ -249,11 +417,18 @@ void Text::ensureGeometryUpdate() const
     // Clear the previous geometry
     m_vertices.clear();
     m_bounds = FloatRect();
+    m_characterPositions.clear();
+    m_lines.clear();
+    m_glyphs.clear();
+    m_advances.clear();
 
     // No font: nothing to draw
     if (!m_font)
         return;
 
+    // Compute the position of the characters
+    updateLayout();
+
     // No text: nothing to draw
     if (m_string.isEmpty())
         return;
@@ -275,137 +450,273 @@ void Text::ensureGeometryUpdate() const
     // Precompute the variables needed by the algorithm
     float hspace = static_cast<float>(m_font->getGlyph(L' ', m_characterSize, bold).advance);
     float vspace = static_cast<float>(m_font->getLineSpacing(m_characterSize));
-    float x      = 0.f;
-    float y      = static_cast<float>(m_characterSize);
 
-    // Create one quad for each character
+    // Create one quad for each character (or for each shaped glyph), line by line
     float minX = static_cast<float>(m_characterSize);
     float minY = static_cast<float>(m_characterSize);
     float maxX = 0.f;
     float maxY = 0.f;
-    Uint32 prevChar = 0;
-    for (std::size_t i = 0; i < m_string.getSize(); ++i)
+    bool shaped = !m_advances.empty();
+    bool subpixel = m_font->isSubpixelPositioningEnabled();
+    std::size_t glyph = 0;
+    for (std::vector<Line>::const_iterator line = m_lines.begin(); line != m_lines.end(); ++line)
     {
-        Uint32 curChar = m_string[i];
+        float y = line->top + static_cast<float>(m_characterSize);
 
-        // Apply the kerning offset
-        x += static_cast<float>(m_font->getKerning(prevChar, curChar, m_characterSize));
-        prevChar = curChar;
+        for (std::size_t i = line->begin; i < line->end; ++i)
+        {
+            Uint32 curChar = m_string[i];
+            float  x       = m_characterPositions[i].x;
+
+            // Handle special characters
+            if ((curChar == ' ') || (curChar == '\t') || (curChar == '\n'))
+            {
+                // Update the current bounds
+                minX = std::min(minX, x);
+                minY = std::min(minY, y);
+
+                switch (curChar)
+                {
+                    case ' ':  maxX = std::max(maxX, x + hspace);     maxY = std::max(maxY, y); break;
+                    case '\t': maxX = std::max(maxX, x + hspace * 4); maxY = std::max(maxY, y); break;
+                    case '\n': maxY = std::max(maxY, y + vspace);                               break;
+                }
+
+                // Next glyph, no need to create a quad for whitespace
+                continue;
+            }
 
-        // If we're using the underlined style and there's a new line, draw a line
-        if (underlined && (curChar == L'\n'))
+            if (shaped)
+            {
+                // Add a quad for each glyph of the cluster starting at the current character
+                while ((glyph < m_glyphs.size()) && (m_glyphs[glyph].character < i))
+                    ++glyph;
+                for (; (glyph < m_glyphs.size()) && (m_glyphs[glyph].character == i); ++glyph)
+                {
+                    const Font::ShapedGlyph& shapedGlyph = m_glyphs[glyph];
+                    Vector2f position(x + shapedGlyph.offset.x, y + shapedGlyph.offset.y);
+                    unsigned int phase = subpixel ? splitSubpixel(position.x) : 0;
+                    addGlyphQuad(m_vertices, position, m_color, m_font->getGlyphByIndex(shapedGlyph.index, m_characterSize, bold, shapedGlyph.face, phase), italic, minX, minY, maxX, maxY);
+                }
+            }
+            else
+            {
+                // Add a quad for the current character; with subpixel positioning, the glyph
+                // is placed on a pixel and the remainder is taken into account by its variant
+                Vector2f position(x, y);
+                unsigned int phase = subpixel ? splitSubpixel(position.x) : 0;
+                addGlyphQuad(m_vertices, position, m_color, m_font->getGlyph(curChar, m_characterSize, bold, phase), italic, minX, minY, maxX, maxY);
+            }
+        }
+
+        // Add the underline and the strike through of the line; lines ended by a line feed
+        // or by the end of the string span their trailing whitespace, other lines don't
+        if (underlined || strikeThrough)
         {
-            float top = std::floor(y + underlineOffset - (underlineThickness / 2) + 0.5f);
-            float bottom = top + std::floor(underlineThickness + 0.5f);
-
-            m_vertices.append(Vertex(Vector2f(0, top),    m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(x, bottom), m_color, Vector2f(1, 1)));
+            float end;
+            if (line->rightToLeft)
+                end = line->left + line->width;
+            else if ((line->end > line->begin) && (m_string[line->end - 1] == '\n'))
+                end = m_characterPositions[line->end - 1].x;
+            else if (line->end == m_string.getSize())
+                end = m_characterPositions[line->end].x;
+            else
+                end = line->left + line->width;
+
+            if (underlined)
+                addLine(m_vertices, line->left, end, y, m_color, underlineOffset, underlineThickness);
+
+            if (strikeThrough)
+                addLine(m_vertices, line->left, end, y, m_color, strikeThroughOffset, underlineThickness);
         }
+    }
+
+    // Update the bounding rectangle
+    m_bounds.left = minX;
+    m_bounds.top = minY;
+    m_bounds.width = maxX - minX;
+    m_bounds.height = maxY - minY;
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::updateLayout() const
+{
+    std::size_t count = m_string.getSize();
+    m_characterPositions.resize(count + 1);
+
+    // Precompute the variables needed by the algorithm
+    bool  bold   = (m_style & Bold) != 0;
+    float hspace = static_cast<float>(m_font->getGlyph(L' ', m_characterSize, bold).advance);
+    float vspace = static_cast<float>(m_font->getLineSpacing(m_characterSize));
 
-        // If we're using the strike through style and there's a new line, draw a line across all characters
-        if (strikeThrough && (curChar == L'\n'))
+    // Break the string into lines, in a single pass: when a character overflows the maximum
+    // width, the characters following the last whitespace of the line are moved to a new line;
+    // since a character is moved at most once per line that it overflows, this stays linear
+    Line        line       = {0, 0, 0.f, 0.f, 0.f, false};
+    std::size_t breakIndex = 0;   // First character after the last whitespace of the line, if > line.begin
+    float       breakWidth = 0.f; // Width of the line before its last whitespace
+    float       width      = 0.f; // Width of the line up to its last glyph
+    float       x          = 0.f;
+    Uint32      prevChar   = 0;
+    std::size_t paragraph  = 0;   // Index of the next paragraph to shape
+    bool        shaped     = false;
+    Font::ShapedRun run;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Uint32 curChar = m_string[i];
+
+        // Shape the paragraph starting at the current character, if the font supports it
+        if (i == paragraph)
         {
-            float top = std::floor(y + strikeThroughOffset - (underlineThickness / 2) + 0.5f);
-            float bottom = top + std::floor(underlineThickness + 0.5f);
-
-            m_vertices.append(Vertex(Vector2f(0, top),    m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(x, bottom), m_color, Vector2f(1, 1)));
+            std::size_t end = i;
+            while ((end < count) && (m_string[end] != '\n'))
+                ++end;
+
+            shaped = (end > i) && m_font->shape(m_string.getData() + i, end - i, m_characterSize, bold, run);
+            if (shaped)
+            {
+                m_advances.resize(count, 0.f);
+                std::copy(run.advances.begin(), run.advances.end(), m_advances.begin() + i);
+                for (std::vector<Font::ShapedGlyph>::const_iterator it = run.glyphs.begin(); it != run.glyphs.end(); ++it)
+                {
+                    m_glyphs.push_back(*it);
+                    m_glyphs.back().character += i;
+                }
+            }
+
+            line.rightToLeft = shaped && run.rightToLeft;
+            paragraph = end + 1;
         }
 
+        // Apply the kerning offset (the shaper already applies it)
+        if (!shaped)
+            x += static_cast<float>(m_font->getKerning(prevChar, curChar, m_characterSize));
+        prevChar = curChar;
+
+        m_characterPositions[i] = Vector2f(x, line.top);
+
         // Handle special characters
-        if ((curChar == ' ') || (curChar == '\t') || (curChar == '\n'))
+        switch (curChar)
         {
-            // Update the current bounds (min coordinates)
-            minX = std::min(minX, x);
-            minY = std::min(minY, y);
+            case ' ':
+            case '\t':
+            {
+                breakIndex = i + 1;
+                breakWidth = width;
+                x += (curChar == ' ') ? hspace : hspace * 4;
+                continue;
+            }
 
-            switch (curChar)
+            case '\n':
             {
-                case ' ':  x += hspace;        break;
-                case '\t': x += hspace * 4;    break;
-                case '\n': y += vspace; x = 0; break;
+                line.end = i + 1;
+                line.width = width;
+                m_lines.push_back(line);
+
+                line.begin = i + 1;
+                line.top += vspace;
+                line.rightToLeft = false;
+                width = 0.f;
+                x = 0.f;
+                continue;
             }
+        }
 
-            // Update the current bounds (max coordinates)
-            maxX = std::max(maxX, x);
-            maxY = std::max(maxY, y);
+        float advance = shaped ? m_advances[i] : static_cast<float>(m_font->getGlyph(curChar, m_characterSize, bold).advance);
 
-            // Next glyph, no need to create a quad for whitespace
-            continue;
-        }
+        // Break the line if the character doesn't fit in the maximum width
+        if ((m_maxWidth > 0.f) && (x + advance > m_maxWidth) && (i > line.begin))
+        {
+            // Move the last word to a new line
+            if (breakIndex > line.begin)
+            {
+                float shift = m_characterPositions[breakIndex].x;
 
-        // Extract the current glyph's description
-        const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, bold);
+                line.end = breakIndex;
+                line.width = breakWidth;
+                m_lines.push_back(line);
 
-        float left   = glyph.bounds.left;
-        float top    = glyph.bounds.top;
-        float right  = glyph.bounds.left + glyph.bounds.width;
-        float bottom = glyph.bounds.top  + glyph.bounds.height;
+                line.begin = breakIndex;
+                line.top += vspace;
+                for (std::size_t j = breakIndex; j <= i; ++j)
+                    m_characterPositions[j] = Vector2f(m_characterPositions[j].x - shift, line.top);
 
-        float u1 = static_cast<float>(glyph.textureRect.left);
-        float v1 = static_cast<float>(glyph.textureRect.top);
-        float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
-        float v2 = static_cast<float>(glyph.textureRect.top  + glyph.textureRect.height);
+                width = std::max(width - shift, 0.f);
+                x -= shift;
+            }
 
-        // Add a quad for the current character
-        m_vertices.append(Vertex(Vector2f(x + left  - italic * top,    y + top),    m_color, Vector2f(u1, v1)));
-        m_vertices.append(Vertex(Vector2f(x + right - italic * top,    y + top),    m_color, Vector2f(u2, v1)));
-        m_vertices.append(Vertex(Vector2f(x + left  - italic * bottom, y + bottom), m_color, Vector2f(u1, v2)));
-        m_vertices.append(Vertex(Vector2f(x + left  - italic * bottom, y + bottom), m_color, Vector2f(u1, v2)));
-        m_vertices.append(Vertex(Vector2f(x + right - italic * top,    y + top),    m_color, Vector2f(u2, v1)));
-        m_vertices.append(Vertex(Vector2f(x + right - italic * bottom, y + bottom), m_color, Vector2f(u2, v2)));
+            // If the word alone is still too wide, break it before the current character
+            if ((x + advance > m_maxWidth) && (i > line.begin))
+            {
+                line.end = i;
+                line.width = width;
+                m_lines.push_back(line);
 
-        // Update the current bounds
-        minX = std::min(minX, x + left - italic * bottom);
-        maxX = std::max(maxX, x + right - italic * top);
-        minY = std::min(minY, y + top);
-        maxY = std::max(maxY, y + bottom);
+                line.begin = i;
+                line.top += vspace;
+                m_characterPositions[i] = Vector2f(0.f, line.top);
+
+                width = 0.f;
+                x = 0.f;
+            }
+        }
 
         // Advance to the next character
-        x += glyph.advance;
+        x += advance;
+        width = x;
     }
 
-    // If we're using the underlined style, add the last line
-    if (underlined)
+    // Add the last line, which also contains the end of the string
+    line.end = count;
+    line.width = width;
+    m_lines.push_back(line);
+    m_characterPositions[count] = Vector2f(x, line.top);
+
+    // Mirror the right-to-left lines, so that their first character is on the right
+    for (std::vector<Line>::const_iterator it = m_lines.begin(); it != m_lines.end(); ++it)
     {
-        float top = std::floor(y + underlineOffset - (underlineThickness / 2) + 0.5f);
-        float bottom = top + std::floor(underlineThickness + 0.5f);
-
-        m_vertices.append(Vertex(Vector2f(0, top),    m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(x, bottom), m_color, Vector2f(1, 1)));
+        if (!it->rightToLeft)
+            continue;
+
+        for (std::size_t i = it->begin; i < it->end; ++i)
+        {
+            float advance;
+            switch (m_string[i])
+            {
+                case ' ':  advance = hspace;        break;
+                case '\t': advance = hspace * 4;    break;
+                case '\n': advance = 0.f;           break;
+                default:   advance = m_advances[i]; break;
+            }
+
+            m_characterPositions[i].x = it->width - m_characterPositions[i].x - advance;
+        }
+
+        if (it->end == count)
+            m_characterPositions[count].x = it->width - m_characterPositions[count].x;
     }
 
-    // If we're using the strike through style, add the last line across all characters
-    if (strikeThrough)
+    // Align the lines
+    if (m_alignment != Left)
     {
-        float top = std::floor(y + strikeThroughOffset - (underlineThickness / 2) + 0.5f);
-        float bottom = top + std::floor(underlineThickness + 0.5f);
-
-        m_vertices.append(Vertex(Vector2f(0, top),    m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(x, bottom), m_color, Vector2f(1, 1)));
-    }
+        float reference = m_maxWidth;
+        if (reference <= 0.f)
+        {
+            for (std::vector<Line>::const_iterator it = m_lines.begin(); it != m_lines.end(); ++it)
+                reference = std::max(reference, it->width);
+        }
 
-    // Update the bounding rectangle
-    m_bounds.left = minX;
-    m_bounds.top = minY;
-    m_bounds.width = maxX - minX;
-    m_bounds.height = maxY - minY;
+        float factor = (m_alignment == Center) ? 0.5f : 1.f;
+        for (std::vector<Line>::iterator it = m_lines.begin(); it != m_lines.end(); ++it)
+        {
+            it->left = std::floor((reference - it->width) * factor);
+            for (std::size_t i = it->begin; i < it->end; ++i)
+                m_characterPositions[i].x += it->left;
+        }
+
+        m_characterPositions[count].x += m_lines.back().left;
+    }
 }
 
 } // namespace sf
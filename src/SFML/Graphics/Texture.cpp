@@ -26,9 +26,11 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureManager.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/TextureSaver.hpp>
+#include <SFML/Graphics/RenderTextureImplFBO.hpp>
 #include <SFML/Window/Context.hpp>
 #include <SFML/Window/Window.hpp>
 #include <SFML/System/Mutex.hpp>
@@ -65,6 +67,19 @@ namespace
 
         return static_cast<unsigned int>(size);
     }
+
+    bool checkNonPowerOfTwoSupport()
+    {
+        // Create a temporary context in case the user queries
+        // the support before a GlResource is created, thus
+        // initializing the shared context
+        sf::Context context;
+
+        // Make sure that extensions are initialized
+        sf::priv::ensureExtensionsInit();
+
+        return GLEXT_texture_non_power_of_two != 0;
+    }
 }
 
 
@@ -78,8 +93,12 @@ m_texture      (0),
 m_isSmooth     (false),
 m_isRepeated   (false),
 m_pixelsFlipped(false),
-m_cacheId      (getUniqueId())
+m_cacheId      (getUniqueId()),
+m_isEvicted    (false),
+m_evictedImage (),
+m_isEvictable  (true)
 {
+    setPixelsFlipped(false);
 }
 
 
@@ -91,9 +110,14 @@ m_texture      (0),
 m_isSmooth     (copy.m_isSmooth),
 m_isRepeated   (copy.m_isRepeated),
 m_pixelsFlipped(false),
-m_cacheId      (getUniqueId())
+m_cacheId      (getUniqueId()),
+m_isEvicted    (false),
+m_evictedImage (),
+m_isEvictable  (true)
 {
-    if (copy.m_texture)
+    setPixelsFlipped(false);
+
+    if (copy.m_texture || copy.m_isEvicted)
         loadFromImage(copy.copyToImage());
 }
 
@@ -109,6 +133,8 @@ Texture::~Texture()
         GLuint texture = static_cast<GLuint>(m_texture);
         glCheck(glDeleteTextures(1, &texture));
     }
+
+    TextureManager::remove(*this);
 }
 
 
@@ -140,13 +166,21 @@ bool Texture::create(unsigned int width, unsigned int height)
     m_size.x        = width;
     m_size.y        = height;
     m_actualSize    = actualSize;
-    m_pixelsFlipped = false;
+    setPixelsFlipped(false);
 
     ensureGlContext();
 
     // Create the OpenGL texture if it doesn't exist yet
     if (!m_texture)
     {
+        // The pixels of an evicted texture are replaced
+        if (m_isEvicted)
+        {
+            m_isEvicted = false;
+            m_evictedImage = Image();
+            TextureManager::remove(*this);
+        }
+
         GLuint texture;
         glCheck(glGenTextures(1, &texture));
         m_texture = static_cast<unsigned int>(texture);
@@ -181,6 +215,9 @@ bool Texture::create(unsigned int width, unsigned int height)
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
     m_cacheId = getUniqueId();
 
+    // Account for the video memory of the texture
+    TextureManager::add(*this, static_cast<Uint64>(m_actualSize.x) * m_actualSize.y * 4, m_isEvictable);
+
     return true;
 }
 
@@ -286,6 +323,10 @@ Vector2u Texture::getSize() const
 ////////////////////////////////////////////////////////////
 Image Texture::copyToImage() const
 {
+    // Easy case: evicted texture, the pixels are already in system memory
+    if (m_isEvicted)
+        return m_evictedImage;
+
     // Easy case: empty texture
     if (!m_texture)
         return Image();
@@ -379,6 +420,9 @@ void Texture::update(const Uint8* pixels, unsigned int width, unsigned int heigh
     assert(x + width <= m_size.x);
     assert(y + height <= m_size.y);
 
+    if (m_isEvicted)
+        restore();
+
     if (pixels && m_texture)
     {
         ensureGlContext();
@@ -389,7 +433,8 @@ void Texture::update(const Uint8* pixels, unsigned int width, unsigned int heigh
         // Copy pixels from the given array to the texture
         glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
         glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
-        m_pixelsFlipped = false;
+        if (m_pixelsFlipped)
+            setPixelsFlipped(false);
         m_cacheId = getUniqueId();
     }
 }
@@ -423,15 +468,22 @@ void Texture::update(const Window& window, unsigned int x, unsigned int y)
     assert(x + window.getSize().x <= m_size.x);
     assert(y + window.getSize().y <= m_size.y);
 
+    if (m_isEvicted)
+        restore();
+
     if (m_texture && window.setActive(true))
     {
+        // Read from the window, not from a render texture that used its context
+        priv::RenderTextureImplFBO::bindDefaultFrameBuffer();
+
         // Make sure that the current texture binding will be preserved
         priv::TextureSaver save;
 
         // Copy pixels from the back-buffer to the texture
         glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
         glCheck(glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x, y, 0, 0, window.getSize().x, window.getSize().y));
-        m_pixelsFlipped = true;
+        if (!m_pixelsFlipped)
+            setPixelsFlipped(true);
         m_cacheId = getUniqueId();
     }
 }
@@ -512,55 +564,29 @@ bool Texture::isRepeated() const
 ////////////////////////////////////////////////////////////
 void Texture::bind(const Texture* texture, CoordinateType coordinateType)
 {
-    ensureGlContext();
-
-    if (texture && texture->m_texture)
+    if (bindTexture(texture))
     {
-        // Bind the texture
-        glCheck(glBindTexture(GL_TEXTURE_2D, texture->m_texture));
-
         // Check if we need to define a special texture matrix
-        if ((coordinateType == Pixels) || texture->m_pixelsFlipped)
+        if (coordinateType == Pixels)
         {
+            // The matrix which converts the range [0 .. size] to [0 .. 1] is already computed
+            loadMatrix(texture->m_pixelsMatrix);
+        }
+        else if (texture->m_pixelsFlipped)
+        {
+            // If pixels are flipped we must invert the Y axis
             GLfloat matrix[16] = {1.f, 0.f, 0.f, 0.f,
-                                  0.f, 1.f, 0.f, 0.f,
+                                  0.f, -1.f, 0.f, 0.f,
                                   0.f, 0.f, 1.f, 0.f,
-                                  0.f, 0.f, 0.f, 1.f};
-
-            // If non-normalized coordinates (= pixels) are requested, we need to
-            // setup scale factors that convert the range [0 .. size] to [0 .. 1]
-            if (coordinateType == Pixels)
-            {
-                matrix[0] = 1.f / texture->m_actualSize.x;
-                matrix[5] = 1.f / texture->m_actualSize.y;
-            }
-
-            // If pixels are flipped we must invert the Y axis
-            if (texture->m_pixelsFlipped)
-            {
-                matrix[5] = -matrix[5];
-                matrix[13] = static_cast<float>(texture->m_size.y) / texture->m_actualSize.y;
-            }
-
-            // Load the matrix
-            glCheck(glMatrixMode(GL_TEXTURE));
-            glCheck(glLoadMatrixf(matrix));
+                                  0.f, static_cast<float>(texture->m_size.y) / texture->m_actualSize.y, 0.f, 1.f};
 
-            // Go back to model-view mode (sf::RenderTarget relies on it)
-            glCheck(glMatrixMode(GL_MODELVIEW));
+            loadMatrix(matrix);
         }
     }
     else
     {
-        // Bind no texture
-        glCheck(glBindTexture(GL_TEXTURE_2D, 0));
-
         // Reset the texture matrix
-        glCheck(glMatrixMode(GL_TEXTURE));
-        glCheck(glLoadIdentity());
-
-        // Go back to model-view mode (sf::RenderTarget relies on it)
-        glCheck(glMatrixMode(GL_MODELVIEW));
+        loadMatrix(NULL);
     }
 }
 
@@ -587,7 +613,10 @@ Texture& Texture::operator =(const Texture& right)
     std::swap(m_texture,       temp.m_texture);
     std::swap(m_isSmooth,      temp.m_isSmooth);
     std::swap(m_isRepeated,    temp.m_isRepeated);
-    std::swap(m_pixelsFlipped, temp.m_pixelsFlipped);
+    std::swap(m_isEvicted,     temp.m_isEvicted);
+    std::swap(m_evictedImage,  temp.m_evictedImage);
+    TextureManager::swap(*this, temp);
+    setPixelsFlipped(temp.m_pixelsFlipped);
     m_cacheId = getUniqueId();
 
     return *this;
@@ -597,6 +626,9 @@ Texture& Texture::operator =(const Texture& right)
 ////////////////////////////////////////////////////////////
 unsigned int Texture::getNativeHandle() const
 {
+    if (m_isEvicted)
+        restore();
+
     return m_texture;
 }
 
@@ -604,12 +636,13 @@ unsigned int Texture::getNativeHandle() const
 ////////////////////////////////////////////////////////////
 unsigned int Texture::getValidSize(unsigned int size)
 {
-    ensureGlContext();
+    // TODO: Remove this lock when it becomes unnecessary in C++11
+    Lock lock(mutex);
 
-    // Make sure that extensions are initialized
-    priv::ensureExtensionsInit();
+    // The hardware support doesn't change, only query it once
+    static bool nonPowerOfTwoAvailable = checkNonPowerOfTwoSupport();
 
-    if (GLEXT_texture_non_power_of_two)
+    if (nonPowerOfTwoAvailable)
     {
         // If hardware supports NPOT textures, then just return the unmodified size
         return size;
@@ -625,4 +658,140 @@ unsigned int Texture::getValidSize(unsigned int size)
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void Texture::markAsModified()
+{
+    m_cacheId = getUniqueId();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::bindTexture(const Texture* texture)
+{
+    ensureGlContext();
+
+    // Upload the pixels of an evicted texture back to the video memory
+    if (texture && texture->m_isEvicted)
+        texture->restore();
+
+    if (texture && texture->m_texture)
+    {
+        // Keep the texture in the video memory as long as possible
+        TextureManager::touch(*texture);
+
+        // Bind the texture
+        glCheck(glBindTexture(GL_TEXTURE_2D, texture->m_texture));
+
+        return true;
+    }
+    else
+    {
+        // Bind no texture
+        glCheck(glBindTexture(GL_TEXTURE_2D, 0));
+
+        return false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::loadMatrix(const float* matrix)
+{
+    glCheck(glMatrixMode(GL_TEXTURE));
+
+    if (matrix)
+    {
+        glCheck(glLoadMatrixf(matrix));
+    }
+    else
+    {
+        glCheck(glLoadIdentity());
+    }
+
+    // Go back to model-view mode (sf::RenderTarget relies on it)
+    glCheck(glMatrixMode(GL_MODELVIEW));
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::setPixelsFlipped(bool flipped) const
+{
+    m_pixelsFlipped = flipped;
+
+    float* matrix = m_pixelsMatrix;
+
+    for (int i = 0; i < 16; ++i)
+        matrix[i] = (i % 5 == 0) ? 1.f : 0.f;
+
+    // Empty texture: nothing to convert
+    if ((m_actualSize.x == 0) || (m_actualSize.y == 0))
+        return;
+
+    // Setup scale factors that convert the range [0 .. size] to [0 .. 1]
+    matrix[0] = 1.f / m_actualSize.x;
+    matrix[5] = 1.f / m_actualSize.y;
+
+    // If pixels are flipped we must invert the Y axis
+    if (m_pixelsFlipped)
+    {
+        matrix[5] = -matrix[5];
+        matrix[13] = static_cast<float>(m_size.y) / m_actualSize.y;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::evict() const
+{
+    if (!m_texture)
+        return;
+
+    // Keep a copy of the pixels in system memory
+    m_evictedImage = copyToImage();
+
+    // Release the video memory
+    ensureGlContext();
+    GLuint texture = static_cast<GLuint>(m_texture);
+    glCheck(glDeleteTextures(1, &texture));
+    m_texture = 0;
+    m_isEvicted = true;
+
+    // The render targets which have the texture in their cache must bind it again
+    m_cacheId = getUniqueId();
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::restore() const
+{
+    ensureGlContext();
+
+    // Make sure that the current texture binding will be preserved
+    priv::TextureSaver save;
+
+    // Recreate the OpenGL texture, with the same settings
+    GLuint texture;
+    glCheck(glGenTextures(1, &texture));
+    m_texture = static_cast<unsigned int>(texture);
+
+    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    glCheck(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_actualSize.x, m_actualSize.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, m_isRepeated ? GL_REPEAT : (GLEXT_texture_edge_clamp ? GLEXT_GL_CLAMP_TO_EDGE : GLEXT_GL_CLAMP)));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, m_isRepeated ? GL_REPEAT : (GLEXT_texture_edge_clamp ? GLEXT_GL_CLAMP_TO_EDGE : GLEXT_GL_CLAMP)));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+
+    // Upload the pixels, which are not flipped anymore
+    glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_size.x, m_size.y, GL_RGBA, GL_UNSIGNED_BYTE, m_evictedImage.getPixelsPtr()));
+    setPixelsFlipped(false);
+
+    m_isEvicted = false;
+    m_evictedImage = Image();
+    m_cacheId = getUniqueId();
+
+    // Account for the video memory again (this may evict other textures)
+    TextureManager::add(*this, static_cast<Uint64>(m_actualSize.x) * m_actualSize.y * 4, m_isEvictable);
+}
+
 } // namespace sf
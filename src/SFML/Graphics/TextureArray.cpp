@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureArray.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/System/Err.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextureArray::TextureArray() :
+m_texture    (),
+m_layerSize  (0, 0),
+m_layerCount (0),
+m_columnCount(0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureArray::create(unsigned int width, unsigned int height, unsigned int layerCount)
+{
+    // Check if texture parameters are valid before creating it
+    if ((width == 0) || (height == 0) || (layerCount == 0))
+    {
+        err() << "Failed to create texture array, invalid size (" << width << "x" << height << "x" << layerCount << ")" << std::endl;
+        return false;
+    }
+
+    // Each layer is surrounded by a border of 1 pixel
+    unsigned int maximumSize = Texture::getMaximumSize();
+    unsigned int cellWidth   = width + 2;
+    unsigned int cellHeight  = height + 2;
+
+    // Lay the layers out in a grid as square as possible, within the maximum texture size
+    double idealColumns = std::ceil(std::sqrt(static_cast<double>(layerCount) * cellHeight / cellWidth));
+    unsigned int columns = std::min(static_cast<unsigned int>(idealColumns), layerCount);
+    columns = std::min(std::max(columns, 1u), maximumSize / cellWidth);
+    unsigned int rows = (columns > 0) ? (layerCount + columns - 1) / columns : 0;
+    if ((columns == 0) || (rows * cellHeight > maximumSize))
+    {
+        err() << "Failed to create texture array, " << layerCount << " layers of " << width << "x" << height
+              << " don't fit in the maximum texture size (" << maximumSize << "x" << maximumSize << ")" << std::endl;
+        return false;
+    }
+
+    if (!m_texture.create(columns * cellWidth, rows * cellHeight))
+    {
+        err() << "Failed to create texture array" << std::endl;
+        return false;
+    }
+
+    m_layerSize   = Vector2u(width, height);
+    m_layerCount  = layerCount;
+    m_columnCount = columns;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureArray::loadFromImage(const Image& image, const Vector2u& layerSize)
+{
+    if ((layerSize.x == 0) || (layerSize.y == 0))
+    {
+        err() << "Failed to load texture array from image, invalid layer size (" << layerSize.x << "x" << layerSize.y << ")" << std::endl;
+        return false;
+    }
+
+    unsigned int columns = image.getSize().x / layerSize.x;
+    unsigned int rows    = image.getSize().y / layerSize.y;
+    if (!create(layerSize.x, layerSize.y, columns * rows))
+        return false;
+
+    // Extract each cell of the sheet, and copy it to its layer
+    std::size_t rowSize = layerSize.x * 4;
+    std::vector<Uint8> pixels(rowSize * layerSize.y);
+    const Uint8* source = image.getPixelsPtr();
+    for (unsigned int i = 0; i < m_layerCount; ++i)
+    {
+        unsigned int left = (i % columns) * layerSize.x;
+        unsigned int top  = (i / columns) * layerSize.y;
+        for (unsigned int y = 0; y < layerSize.y; ++y)
+            std::memcpy(&pixels[rowSize * y], source + ((top + y) * image.getSize().x + left) * 4, rowSize);
+
+        update(i, &pixels[0]);
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::update(unsigned int layer, const Uint8* pixels)
+{
+    if (!pixels || (layer >= m_layerCount))
+        return;
+
+    // Surround the layer with a copy of its edges, so that smoothing doesn't read the neighbour layers
+    unsigned int width   = m_layerSize.x + 2;
+    unsigned int height  = m_layerSize.y + 2;
+    std::size_t rowSize  = m_layerSize.x * 4;
+    std::vector<Uint8> buffer(width * height * 4);
+    for (unsigned int y = 0; y < height; ++y)
+    {
+        unsigned int sourceRow = std::min(std::max(y, 1u) - 1, m_layerSize.y - 1);
+        const Uint8* source = pixels + rowSize * sourceRow;
+        Uint8* destination  = &buffer[width * 4 * y];
+
+        std::memcpy(destination, source, 4);
+        std::memcpy(destination + 4, source, rowSize);
+        std::memcpy(destination + 4 + rowSize, source + rowSize - 4, 4);
+    }
+
+    unsigned int column = layer % m_columnCount;
+    unsigned int row    = layer / m_columnCount;
+    m_texture.update(&buffer[0], width, height, column * width, row * height);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::update(unsigned int layer, const Image& image)
+{
+    if (image.getSize() != m_layerSize)
+    {
+        err() << "Failed to update texture array layer, the image size (" << image.getSize().x << "x" << image.getSize().y
+              << ") is not the layer size (" << m_layerSize.x << "x" << m_layerSize.y << ")" << std::endl;
+        return;
+    }
+
+    update(layer, image.getPixelsPtr());
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TextureArray::getLayerSize() const
+{
+    return m_layerSize;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TextureArray::getLayerCount() const
+{
+    return m_layerCount;
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect TextureArray::getLayerRect(unsigned int layer) const
+{
+    if (layer >= m_layerCount)
+        return IntRect();
+
+    int column = static_cast<int>(layer % m_columnCount);
+    int row    = static_cast<int>(layer / m_columnCount);
+    int width  = static_cast<int>(m_layerSize.x);
+    int height = static_cast<int>(m_layerSize.y);
+
+    return IntRect(column * (width + 2) + 1, row * (height + 2) + 1, width, height);
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f TextureArray::getTexCoords(unsigned int layer, const Vector2f& coords) const
+{
+    IntRect rect = getLayerRect(layer);
+
+    return Vector2f(rect.left + coords.x, rect.top + coords.y);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::setSmooth(bool smooth)
+{
+    m_texture.setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureArray::isSmooth() const
+{
+    return m_texture.isSmooth();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureArray::getTexture() const
+{
+    return m_texture;
+}
+
+} // namespace sf
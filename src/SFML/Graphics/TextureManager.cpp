@@ -0,0 +1,321 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureManager.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/ResourceAccess.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+#include <map>
+
+
+namespace
+{
+    // Number of most recently bound textures which are never evicted:
+    // shaders bind several textures in a row, they must all stay valid
+    const sf::Uint64 protectedUseCount = 8;
+
+    // Tracking information of a texture; the resident textures are
+    // linked from the least recently used to the most recently used
+    struct Entry
+    {
+        const sf::Texture* texture;
+        sf::Uint64         memory;
+        sf::Uint64         lastUse;
+        bool               isEvictable;
+        bool               isResident;
+        Entry*             previous;
+        Entry*             next;
+    };
+
+    // All the textures which have pixels, and the global counters
+    struct Registry
+    {
+        Registry() :
+        leastRecent   (NULL),
+        mostRecent    (NULL),
+        budget        (0),
+        useCount      (0),
+        residentMemory(0),
+        evictedMemory (0),
+        evictedCount  (0),
+        evictions     (0),
+        restorations  (0)
+        {
+        }
+
+        sf::Mutex                            mutex;
+        std::map<const sf::Texture*, Entry*> entries;
+        Entry*                               leastRecent;
+        Entry*                               mostRecent;
+        sf::Uint64                           budget;
+        sf::Uint64                           useCount;
+        sf::Uint64                           residentMemory;
+        sf::Uint64                           evictedMemory;
+        unsigned int                         evictedCount;
+        unsigned int                         evictions;
+        unsigned int                         restorations;
+    };
+
+    // Is a budget set? Read without locking when a texture is bound, so that
+    // applications which don't use a budget don't pay for the tracking; a stale
+    // value only makes a few textures look more or less recently used
+    volatile bool budgetEnabled = false;
+
+    // The registry is never destroyed, so that textures destroyed
+    // at exit (after the static objects of this file) can still use it
+    Registry& getRegistry()
+    {
+        static Registry* registry = new Registry;
+
+        return *registry;
+    }
+
+    // Remove an entry from the list of resident textures
+    void unlink(Registry& registry, Entry* entry)
+    {
+        if (entry->previous)
+            entry->previous->next = entry->next;
+        else
+            registry.leastRecent = entry->next;
+
+        if (entry->next)
+            entry->next->previous = entry->previous;
+        else
+            registry.mostRecent = entry->previous;
+
+        entry->previous = NULL;
+        entry->next     = NULL;
+    }
+
+    // Add an entry at the most recently used end of the list of resident textures
+    void append(Registry& registry, Entry* entry)
+    {
+        entry->previous = registry.mostRecent;
+        entry->next     = NULL;
+
+        if (registry.mostRecent)
+            registry.mostRecent->next = entry;
+        else
+            registry.leastRecent = entry;
+
+        registry.mostRecent = entry;
+        entry->lastUse = ++registry.useCount;
+    }
+
+    // Remove the memory of an entry from the totals, and the entry from the list
+    void subtract(Registry& registry, Entry* entry)
+    {
+        if (entry->isResident)
+        {
+            registry.residentMemory -= entry->memory;
+            unlink(registry, entry);
+        }
+        else
+        {
+            registry.evictedMemory -= entry->memory;
+            registry.evictedCount--;
+        }
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void TextureManager::setBudget(Uint64 bytes)
+{
+    Registry& registry = getRegistry();
+    Lock lock(registry.mutex);
+
+    registry.budget = bytes;
+    budgetEnabled = (bytes > 0);
+    enforceBudget();
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 TextureManager::getBudget()
+{
+    Registry& registry = getRegistry();
+    Lock lock(registry.mutex);
+
+    return registry.budget;
+}
+
+
+////////////////////////////////////////////////////////////
+TextureManager::Statistics TextureManager::getStatistics()
+{
+    Registry& registry = getRegistry();
+    Lock lock(registry.mutex);
+
+    Statistics statistics;
+    statistics.residentMemory = registry.residentMemory;
+    statistics.evictedMemory  = registry.evictedMemory;
+    statistics.textureCount   = static_cast<unsigned int>(registry.entries.size());
+    statistics.evictedCount   = registry.evictedCount;
+    statistics.evictions      = registry.evictions;
+    statistics.restorations   = registry.restorations;
+
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureManager::add(const Texture& texture, Uint64 memory, bool evictable)
+{
+    Registry& registry = getRegistry();
+    Lock lock(registry.mutex);
+
+    Entry*& entry = registry.entries[&texture];
+    if (entry)
+    {
+        // The texture is reallocated, or restored
+        if (!entry->isResident)
+            registry.restorations++;
+
+        subtract(registry, entry);
+    }
+    else
+    {
+        entry = new Entry;
+        entry->texture  = &texture;
+        entry->previous = NULL;
+        entry->next     = NULL;
+    }
+
+    entry->memory      = memory;
+    entry->isEvictable = evictable;
+    entry->isResident  = true;
+    append(registry, entry);
+    registry.residentMemory += entry->memory;
+
+    enforceBudget();
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureManager::remove(const Texture& texture)
+{
+    Registry& registry = getRegistry();
+    Lock lock(registry.mutex);
+
+    std::map<const Texture*, Entry*>::iterator it = registry.entries.find(&texture);
+    if (it != registry.entries.end())
+    {
+        subtract(registry, it->second);
+        delete it->second;
+        registry.entries.erase(it);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureManager::touch(const Texture& texture)
+{
+    // The order of the textures only matters when they may be evicted
+    if (!budgetEnabled)
+        return;
+
+    Registry& registry = getRegistry();
+    Lock lock(registry.mutex);
+
+    std::map<const Texture*, Entry*>::iterator it = registry.entries.find(&texture);
+    if ((it != registry.entries.end()) && it->second->isResident && (it->second != registry.mostRecent))
+    {
+        unlink(registry, it->second);
+        append(registry, it->second);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureManager::swap(const Texture& left, const Texture& right)
+{
+    Registry& registry = getRegistry();
+    Lock lock(registry.mutex);
+
+    std::map<const Texture*, Entry*>::iterator leftIt  = registry.entries.find(&left);
+    std::map<const Texture*, Entry*>::iterator rightIt = registry.entries.find(&right);
+    Entry* leftEntry  = (leftIt  != registry.entries.end()) ? leftIt->second  : NULL;
+    Entry* rightEntry = (rightIt != registry.entries.end()) ? rightIt->second : NULL;
+
+    // The entries stay at their place in the list, only their owner changes
+    if (leftEntry)
+    {
+        leftEntry->texture = &right;
+        registry.entries.erase(leftIt);
+    }
+    if (rightEntry)
+    {
+        rightEntry->texture = &left;
+        registry.entries.erase(rightIt);
+    }
+
+    if (leftEntry)
+        registry.entries[&right] = leftEntry;
+    if (rightEntry)
+        registry.entries[&left] = rightEntry;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureManager::enforceBudget()
+{
+    Registry& registry = getRegistry();
+    Lock lock(registry.mutex);
+
+    // Evict the least recently used textures first
+    Entry* entry = registry.leastRecent;
+    while ((registry.budget > 0) && (registry.residentMemory > registry.budget) && entry)
+    {
+        // The next textures are even more recent: the budget can't be respected
+        if (registry.useCount - entry->lastUse < protectedUseCount)
+            break;
+
+        Entry* next = entry->next;
+
+        // The textures of render textures are skipped
+        if (entry->isEvictable)
+        {
+            priv::ResourceAccess::evict(*entry->texture);
+
+            unlink(registry, entry);
+            registry.residentMemory -= entry->memory;
+            registry.evictedMemory  += entry->memory;
+            registry.evictedCount++;
+            registry.evictions++;
+            entry->isResident = false;
+        }
+
+        entry = next;
+    }
+}
+
+} // namespace sf
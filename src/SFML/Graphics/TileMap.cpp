@@ -0,0 +1,233 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TileMap.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/GridCulling.hpp>
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TileMap::TileMap() :
+m_tileset   (NULL),
+m_size      (0, 0),
+m_tileSize  (0, 0),
+m_chunkSize (1),
+m_chunkCount(0, 0),
+m_tiles     (),
+m_chunks    ()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::create(const Vector2u& size, const Vector2u& tileSize, unsigned int chunkSize)
+{
+    m_size       = size;
+    m_tileSize   = tileSize;
+    m_chunkSize  = std::max(chunkSize, 1u);
+    m_chunkCount = Vector2u((size.x + m_chunkSize - 1) / m_chunkSize, (size.y + m_chunkSize - 1) / m_chunkSize);
+
+    m_tiles.assign(size.x * size.y, -1);
+    m_chunks.clear();
+    m_chunks.resize(m_chunkCount.x * m_chunkCount.y);
+    invalidateChunks();
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTileset(const Texture* tileset)
+{
+    // The texture coordinates depend on the layout of the tileset
+    m_tileset = tileset;
+    invalidateChunks();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* TileMap::getTileset() const
+{
+    return m_tileset;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTile(unsigned int x, unsigned int y, int tile)
+{
+    if ((x >= m_size.x) || (y >= m_size.y))
+        return;
+
+    int& current = m_tiles[y * m_size.x + x];
+    if (current != tile)
+    {
+        current = tile;
+        m_chunks[(y / m_chunkSize) * m_chunkCount.x + x / m_chunkSize].dirty = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+int TileMap::getTile(unsigned int x, unsigned int y) const
+{
+    if ((x >= m_size.x) || (y >= m_size.y))
+        return -1;
+
+    return m_tiles[y * m_size.x + x];
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2u& TileMap::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2u& TileMap::getTileSize() const
+{
+    return m_tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getLocalBounds() const
+{
+    float width  = static_cast<float>(m_size.x * m_tileSize.x);
+    float height = static_cast<float>(m_size.y * m_tileSize.y);
+
+    return FloatRect(0.f, 0.f, width, height);
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_chunks.empty() || (m_tileSize.x == 0) || (m_tileSize.y == 0))
+        return;
+
+    states.transform *= getTransform();
+    states.texture = m_tileset;
+
+    // Find the chunks which are covered by the view
+    Vector2f chunkSize(static_cast<float>(m_chunkSize * m_tileSize.x), static_cast<float>(m_chunkSize * m_tileSize.y));
+    Vector2u first;
+    Vector2u last;
+    if (!priv::findVisibleCells(target, states.transform, chunkSize, m_chunkCount, first, last))
+        return;
+
+    // Draw the visible chunks, rebuilding the ones that were modified
+    for (unsigned int row = first.y; row <= last.y; ++row)
+    {
+        for (unsigned int column = first.x; column <= last.x; ++column)
+        {
+            const Chunk& chunk = m_chunks[row * m_chunkCount.x + column];
+            if (chunk.dirty)
+                updateChunk(column, row);
+
+            if (!chunk.vertices.empty())
+                target.draw(&chunk.vertices[0], chunk.vertices.size(), Triangles, states);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::updateChunk(unsigned int column, unsigned int row) const
+{
+    Chunk& chunk = m_chunks[row * m_chunkCount.x + column];
+    chunk.vertices.clear();
+    chunk.dirty = false;
+
+    // Number of tiles in a row of the tileset
+    unsigned int tilesPerRow = 1;
+    if (m_tileset)
+        tilesPerRow = std::max(m_tileset->getSize().x / m_tileSize.x, 1u);
+
+    unsigned int beginX = column * m_chunkSize;
+    unsigned int beginY = row * m_chunkSize;
+    unsigned int endX   = std::min(beginX + m_chunkSize, m_size.x);
+    unsigned int endY   = std::min(beginY + m_chunkSize, m_size.y);
+
+    float width  = static_cast<float>(m_tileSize.x);
+    float height = static_cast<float>(m_tileSize.y);
+
+    for (unsigned int y = beginY; y < endY; ++y)
+    {
+        for (unsigned int x = beginX; x < endX; ++x)
+        {
+            int tile = m_tiles[y * m_size.x + x];
+            if (tile < 0)
+                continue;
+
+            // Position of the tile in the map
+            float left   = x * width;
+            float top    = y * height;
+            float right  = left + width;
+            float bottom = top + height;
+
+            // Position of the tile in the tileset
+            float texLeft   = (tile % tilesPerRow) * width;
+            float texTop    = (tile / tilesPerRow) * height;
+            float texRight  = texLeft + width;
+            float texBottom = texTop + height;
+
+            // Two triangles per tile
+            Vertex topLeft    (Vector2f(left, top),     Vector2f(texLeft, texTop));
+            Vertex topRight   (Vector2f(right, top),    Vector2f(texRight, texTop));
+            Vertex bottomLeft (Vector2f(left, bottom),  Vector2f(texLeft, texBottom));
+            Vertex bottomRight(Vector2f(right, bottom), Vector2f(texRight, texBottom));
+            chunk.vertices.push_back(topLeft);
+            chunk.vertices.push_back(topRight);
+            chunk.vertices.push_back(bottomLeft);
+            chunk.vertices.push_back(bottomLeft);
+            chunk.vertices.push_back(topRight);
+            chunk.vertices.push_back(bottomRight);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::invalidateChunks()
+{
+    for (std::vector<Chunk>::iterator it = m_chunks.begin(); it != m_chunks.end(); ++it)
+        it->dirty = true;
+}
+
+} // namespace sf
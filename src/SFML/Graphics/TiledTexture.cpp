@@ -0,0 +1,236 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TiledTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Err.hpp>
+#include <algorithm>
+#include <cstring>
+
+
+namespace
+{
+    // Tile size used when none is specified
+    const unsigned int defaultTileSize = 1024;
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TiledTexture::TiledTexture() :
+m_image    (),
+m_tileSize (0),
+m_tileCount(0, 0),
+m_tiles    (),
+m_isSmooth (false)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TiledTexture::~TiledTexture()
+{
+    for (std::vector<Texture*>::iterator it = m_tiles.begin(); it != m_tiles.end(); ++it)
+        delete *it;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TiledTexture::loadFromFile(const std::string& filename, unsigned int tileSize)
+{
+    Image image;
+    return image.loadFromFile(filename) && loadFromImage(image, tileSize);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TiledTexture::loadFromImage(const Image& image, unsigned int tileSize)
+{
+    Vector2u size = image.getSize();
+    if ((size.x == 0) || (size.y == 0))
+    {
+        err() << "Failed to load tiled texture, invalid image size (" << size.x << "x" << size.y << ")" << std::endl;
+        return false;
+    }
+
+    // A tile and its border must fit in a texture
+    unsigned int maximumSize = Texture::getMaximumSize();
+    if (maximumSize <= 2)
+    {
+        err() << "Failed to load tiled texture, textures are not supported" << std::endl;
+        return false;
+    }
+
+    if (tileSize == 0)
+        tileSize = defaultTileSize;
+    tileSize = std::min(tileSize, maximumSize - 2);
+
+    // Release the previous tiles
+    for (std::vector<Texture*>::iterator it = m_tiles.begin(); it != m_tiles.end(); ++it)
+        delete *it;
+
+    m_image     = image;
+    m_tileSize  = tileSize;
+    m_tileCount = Vector2u((size.x + tileSize - 1) / tileSize, (size.y + tileSize - 1) / tileSize);
+    m_tiles.assign(m_tileCount.x * m_tileCount.y, NULL);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TiledTexture::getSize() const
+{
+    return m_image.getSize();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TiledTexture::getTileSize() const
+{
+    return m_tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TiledTexture::getTileCount() const
+{
+    return m_tileCount;
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect TiledTexture::getTileRect(unsigned int x, unsigned int y) const
+{
+    if ((x >= m_tileCount.x) || (y >= m_tileCount.y))
+        return IntRect();
+
+    Vector2u     size   = m_image.getSize();
+    unsigned int left   = x * m_tileSize;
+    unsigned int top    = y * m_tileSize;
+    unsigned int width  = std::min(m_tileSize, size.x - left);
+    unsigned int height = std::min(m_tileSize, size.y - top);
+
+    return IntRect(left, top, width, height);
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* TiledTexture::getTile(unsigned int x, unsigned int y) const
+{
+    if ((x >= m_tileCount.x) || (y >= m_tileCount.y))
+        return NULL;
+
+    Texture*& tile = m_tiles[y * m_tileCount.x + x];
+    if (tile)
+        return tile;
+
+    // Copy the pixels of the tile, surrounded by a copy of the
+    // neighbour pixels (or of its own edge on the image borders)
+    IntRect      rect   = getTileRect(x, y);
+    Vector2u     size   = m_image.getSize();
+    unsigned int width  = rect.width + 2;
+    unsigned int height = rect.height + 2;
+    std::vector<Uint8> pixels(width * height * 4);
+
+    const Uint8* source     = m_image.getPixelsPtr();
+    int          lastColumn = static_cast<int>(size.x) - 1;
+    int          lastRow    = static_cast<int>(size.y) - 1;
+    int          leftX      = std::max(rect.left - 1, 0);
+    int          rightX     = std::min(rect.left + rect.width, lastColumn);
+    for (unsigned int row = 0; row < height; ++row)
+    {
+        int sourceY = std::min(std::max(rect.top + static_cast<int>(row) - 1, 0), lastRow);
+        const Uint8* sourceRow = source + static_cast<std::size_t>(sourceY) * size.x * 4;
+        Uint8* destination = &pixels[static_cast<std::size_t>(row) * width * 4];
+
+        std::memcpy(destination, sourceRow + leftX * 4, 4);
+        std::memcpy(destination + 4, sourceRow + rect.left * 4, rect.width * 4);
+        std::memcpy(destination + (width - 1) * 4, sourceRow + rightX * 4, 4);
+    }
+
+    // Upload them
+    Texture* texture = new Texture;
+    if (!texture->create(width, height))
+    {
+        err() << "Failed to create the texture of tile (" << x << ", " << y << ") of tiled texture" << std::endl;
+        delete texture;
+        return NULL;
+    }
+    texture->update(&pixels[0]);
+    texture->setSmooth(m_isSmooth);
+
+    tile = texture;
+
+    return tile;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TiledTexture::isTileLoaded(unsigned int x, unsigned int y) const
+{
+    if ((x >= m_tileCount.x) || (y >= m_tileCount.y))
+        return false;
+
+    return m_tiles[y * m_tileCount.x + x] != NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+void TiledTexture::unloadTile(unsigned int x, unsigned int y)
+{
+    if ((x >= m_tileCount.x) || (y >= m_tileCount.y))
+        return;
+
+    Texture*& tile = m_tiles[y * m_tileCount.x + x];
+    delete tile;
+    tile = NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+void TiledTexture::setSmooth(bool smooth)
+{
+    m_isSmooth = smooth;
+
+    for (std::vector<Texture*>::iterator it = m_tiles.begin(); it != m_tiles.end(); ++it)
+    {
+        if (*it)
+            (*it)->setSmooth(smooth);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool TiledTexture::isSmooth() const
+{
+    return m_isSmooth;
+}
+
+} // namespace sf
@@ -26,6 +26,8 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/SSE.hpp>
 #include <cmath>
 
 
@@ -109,17 +111,88 @@ Vector2f Transform::transformPoint(const Vector2f& point) const
 }
 
 
+////////////////////////////////////////////////////////////
+void Transform::transformPoints(const Vector2f* points, Vector2f* result, std::size_t count) const
+{
+    std::size_t i = 0;
+
+#ifdef SFML_SSE
+
+    // Two points per register: [x0 y0 x1 y1]
+    const __m128 xFactors = _mm_setr_ps(m_matrix[0],  m_matrix[1],  m_matrix[0],  m_matrix[1]);
+    const __m128 yFactors = _mm_setr_ps(m_matrix[4],  m_matrix[5],  m_matrix[4],  m_matrix[5]);
+    const __m128 offsets  = _mm_setr_ps(m_matrix[12], m_matrix[13], m_matrix[12], m_matrix[13]);
+
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128 xy = _mm_loadu_ps(&points[i].x);
+        __m128 xx = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(2, 2, 0, 0));
+        __m128 yy = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(3, 3, 1, 1));
+        _mm_storeu_ps(&result[i].x, _mm_add_ps(_mm_add_ps(_mm_mul_ps(xx, xFactors), _mm_mul_ps(yy, yFactors)), offsets));
+    }
+
+#endif
+
+    // Remaining points (or all of them without SSE)
+    for (; i < count; ++i)
+        result[i] = transformPoint(points[i]);
+}
+
+
+////////////////////////////////////////////////////////////
+void Transform::transformVertices(const Vertex* vertices, Vertex* result, std::size_t count) const
+{
+    std::size_t i = 0;
+
+#ifdef SFML_SSE
+
+    // Two positions per register: [x0 y0 x1 y1]
+    const __m128 xFactors = _mm_setr_ps(m_matrix[0],  m_matrix[1],  m_matrix[0],  m_matrix[1]);
+    const __m128 yFactors = _mm_setr_ps(m_matrix[4],  m_matrix[5],  m_matrix[4],  m_matrix[5]);
+    const __m128 offsets  = _mm_setr_ps(m_matrix[12], m_matrix[13], m_matrix[12], m_matrix[13]);
+
+    for (; i + 2 <= count; i += 2)
+    {
+        // Positions are not contiguous, load and store them by halves
+        __m128 xy = _mm_setzero_ps();
+        xy = _mm_loadl_pi(xy, reinterpret_cast<const __m64*>(&vertices[i].position));
+        xy = _mm_loadh_pi(xy, reinterpret_cast<const __m64*>(&vertices[i + 1].position));
+        __m128 xx = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(2, 2, 0, 0));
+        __m128 yy = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(3, 3, 1, 1));
+        xy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xx, xFactors), _mm_mul_ps(yy, yFactors)), offsets);
+
+        result[i].color         = vertices[i].color;
+        result[i].texCoords     = vertices[i].texCoords;
+        result[i + 1].color     = vertices[i + 1].color;
+        result[i + 1].texCoords = vertices[i + 1].texCoords;
+        _mm_storel_pi(reinterpret_cast<__m64*>(&result[i].position), xy);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(&result[i + 1].position), xy);
+    }
+
+#endif
+
+    // Remaining vertices (or all of them without SSE)
+    for (; i < count; ++i)
+    {
+        result[i].position  = transformPoint(vertices[i].position);
+        result[i].color     = vertices[i].color;
+        result[i].texCoords = vertices[i].texCoords;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 FloatRect Transform::transformRect(const FloatRect& rectangle) const
 {
     // Transform the 4 corners of the rectangle
-    const Vector2f points[] =
+    Vector2f points[] =
     {
-        transformPoint(rectangle.left, rectangle.top),
-        transformPoint(rectangle.left, rectangle.top + rectangle.height),
-        transformPoint(rectangle.left + rectangle.width, rectangle.top),
-        transformPoint(rectangle.left + rectangle.width, rectangle.top + rectangle.height)
+        Vector2f(rectangle.left, rectangle.top),
+        Vector2f(rectangle.left, rectangle.top + rectangle.height),
+        Vector2f(rectangle.left + rectangle.width, rectangle.top),
+        Vector2f(rectangle.left + rectangle.width, rectangle.top + rectangle.height)
     };
+    transformPoints(points, points, 4);
 
     // Compute the bounding rectangle of the transformed points
     float left = points[0].x;
@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/SSE.hpp>
 
 
 namespace sf
@@ -112,8 +113,36 @@ FloatRect VertexArray::getBounds() const
         float top    = m_vertices[0].position.y;
         float right  = m_vertices[0].position.x;
         float bottom = m_vertices[0].position.y;
+        std::size_t i = 1;
 
-        for (std::size_t i = 1; i < m_vertices.size(); ++i)
+#ifdef SFML_SSE
+
+        // Two positions per register: [x0 y0 x1 y1]
+        __m128 minimum = _mm_setr_ps(left, top, left, top);
+        __m128 maximum = minimum;
+
+        for (; i + 2 <= m_vertices.size(); i += 2)
+        {
+            __m128 xy = minimum;
+            xy = _mm_loadl_pi(xy, reinterpret_cast<const __m64*>(&m_vertices[i].position));
+            xy = _mm_loadh_pi(xy, reinterpret_cast<const __m64*>(&m_vertices[i + 1].position));
+            minimum = _mm_min_ps(minimum, xy);
+            maximum = _mm_max_ps(maximum, xy);
+        }
+
+        // Merge the two halves
+        float extremes[4];
+        _mm_storeu_ps(extremes, _mm_movelh_ps(_mm_min_ps(minimum, _mm_movehl_ps(minimum, minimum)),
+                                              _mm_max_ps(maximum, _mm_movehl_ps(maximum, maximum))));
+        left   = extremes[0];
+        top    = extremes[1];
+        right  = extremes[2];
+        bottom = extremes[3];
+
+#endif
+
+        // Remaining vertices (or all of them without SSE)
+        for (; i < m_vertices.size(); ++i)
         {
             Vector2f position = m_vertices[i].position;
 
@@ -130,6 +130,21 @@ namespace
     // The hidden, inactive context that will be shared with all other contexts
     ContextType* sharedContext = NULL;
 
+    // Thread-safe unique identifier generator,
+    // is used to tell contexts apart (see getActiveContextId)
+    sf::Uint64 getUniqueId()
+    {
+        sf::Lock lock(mutex);
+
+        static sf::Uint64 id = 1; // start at 1, zero is "no context"
+
+        return id++;
+    }
+
+    // Functions to call when a context is destroyed
+    std::set<sf::priv::GlContext::DestroyCallback> destroyCallbacks;
+    sf::Mutex destroyCallbacksMutex;
+
     // Internal contexts
     sf::ThreadLocalPtr<sf::priv::GlContext> internalContext(NULL);
     std::set<sf::priv::GlContext*> internalContexts;
@@ -272,12 +287,37 @@ GlFunctionPointer GlContext::getFunction(const char* name)
 }
 
 
+////////////////////////////////////////////////////////////
+Uint64 GlContext::getActiveContextId()
+{
+    return currentContext ? currentContext->m_id : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void GlContext::registerDestroyCallback(DestroyCallback callback)
+{
+    Lock lock(destroyCallbacksMutex);
+    destroyCallbacks.insert(callback);
+}
+
+
 ////////////////////////////////////////////////////////////
 GlContext::~GlContext()
 {
     // Deactivate the context before killing it, unless we're inside Cleanup()
     if (sharedContext)
         setActive(false);
+
+    // Let the other modules release what they stored for this context; the callbacks
+    // are called outside of the lock, since they take their own mutexes
+    std::set<DestroyCallback> callbacks;
+    {
+        Lock lock(destroyCallbacksMutex);
+        callbacks = destroyCallbacks;
+    }
+    for (std::set<DestroyCallback>::iterator it = callbacks.begin(); it != callbacks.end(); ++it)
+        (*it)(m_id);
 }
 
 
@@ -333,9 +373,9 @@ bool GlContext::setActive(bool active)
 
 
 ////////////////////////////////////////////////////////////
-GlContext::GlContext()
+GlContext::GlContext() :
+m_id(getUniqueId())
 {
-    // Nothing to do
 }
 
 
@@ -130,6 +130,35 @@ public:
     ////////////////////////////////////////////////////////////
     static GlFunctionPointer getFunction(const char* name);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the unique identifier of the context active on the current thread
+    ///
+    /// \return Identifier of the active context, or 0 if no context is active
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getActiveContextId();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Type of the functions called when a context is destroyed
+    ///
+    ////////////////////////////////////////////////////////////
+    typedef void (*DestroyCallback)(Uint64 contextId);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Register a function to call when a context is destroyed
+    ///
+    /// The callback receives the identifier of the context (see
+    /// getActiveContextId), so that per-context data can be
+    /// released. It is called from the destructor, when the
+    /// context can no longer be activated: OpenGL objects that
+    /// are not shared die with the context anyway.
+    /// Registering the same function twice has no effect.
+    ///
+    /// \param callback Function to call
+    ///
+    ////////////////////////////////////////////////////////////
+    static void registerDestroyCallback(DestroyCallback callback);
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -242,6 +271,11 @@ private:
     ///
     ////////////////////////////////////////////////////////////
     void checkSettings(const ContextSettings& requestedSettings);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Uint64 m_id; ///< Unique number that identifies the context
 };
 
 } // namespace priv
@@ -82,4 +82,11 @@ void GlResource::ensureGlContext()
     priv::GlContext::ensureContext();
 }
 
+
+////////////////////////////////////////////////////////////
+void GlResource::registerContextDestroyCallback(ContextDestroyCallback callback)
+{
+    priv::GlContext::registerDestroyCallback(callback);
+}
+
 } // namespace sf